@@ -0,0 +1,47 @@
+#ifndef AUTOSAVE_H_INCLUDED
+#define AUTOSAVE_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Dateien der automatischen Sicherung des laufenden Spiels
+#define AUTOSAVE_SNAPSHOT_FILE "autosave.skram"
+#define AUTOSAVE_TEMP_FILE "autosave.tmp"
+#define AUTOSAVE_LOG_FILE "autosave.log"
+
+// Das Abbild ist ein Spielstand im Format aus savegame.h samt Zugverlauf. Jeder Zug danach wird an das Protokoll
+// angehängt (alle Zahlen little-endian):
+//   0   "SKAL", uint32 Version, uint32 CRC-32 des zugehörigen Abbilds, uint32 CRC-32 der vorherigen 12 Bytes
+//   16  Einträge zu je 12 Bytes: uint16 Feld, uint8 Wert, uint8 Art (AUTOSAVE_*), uint32 Zeit in Millisekunden,
+//       uint32 CRC-32 der vorherigen 8 Bytes
+// Passt der Kopf nicht zum Abbild, ist das Protokoll durch ein neueres Abbild überholt und wird ignoriert. Ein
+// abgeschnittener oder beschädigter Eintrag beendet das Protokoll.
+#define AUTOSAVE_VERSION 1
+#define AUTOSAVE_HEADER_SIZE 16
+#define AUTOSAVE_RECORD_SIZE 12
+
+// Einträge bis zum nächsten fsync bzw. bis zum nächsten Abbild
+#define AUTOSAVE_SYNC_RECORDS 8
+#define AUTOSAVE_SNAPSHOT_RECORDS 128
+
+// Arten von Einträgen
+#define AUTOSAVE_MOVE 1 //! Wert in ein Feld eingetragen (auch per Tipp)
+#define AUTOSAVE_UNDO 2 //! Zug rückgängig gemacht
+#define AUTOSAVE_REDO 3 //! Zug wiederholt
+
+// Laufende automatische Sicherung
+struct autosave {
+    FILE *log;            // Geöffnetes Protokoll (NULL = Sicherung nicht aktiv)
+    uint32_t snapshotCrc; // CRC-32 des aktuellen Abbilds
+    int unsynced;         // Einträge seit dem letzten fsync
+    int records;          // Einträge seit dem letzten Abbild
+};
+
+// Funktionen der automatischen Sicherung
+int startAutosave(struct autosave *autosave, const struct savegame *sudoku, const struct journal *journal);
+int writeAutosaveSnapshot(struct autosave *autosave, const struct savegame *sudoku, const struct journal *journal);
+int logAutosave(struct autosave *autosave, int type, int cell, int value, uint32_t time);
+int needsAutosaveSnapshot(const struct autosave *autosave);
+void stopAutosave(struct autosave *autosave, int discard);
+int recoverAutosave(struct savegame *sudoku, struct journal *journal);
+
+#endif // AUTOSAVE_H_INCLUDED
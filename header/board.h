@@ -0,0 +1,81 @@
+#ifndef BOARD_H_INCLUDED
+#define BOARD_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Kompaktes Spielfeld: ein Byte je Feld, Bitmap der vorgegebenen Felder und
+// laufend gepflegte Belegungsmasken je Zeile, Spalte und Block (bei 9x9 152 Bytes statt 648 Bytes für 'struct sudoku')
+struct board {
+    uint64_t given[(GRID_CELLS + 63) / 64]; // Bit i = Feld i ist vorgegeben und kann nicht geändert werden
+    uint8_t value[GRID_CELLS];              // Werte im Sudoku (zeilenweise, 0 = leer)
+    digitMask rowMask[SIZE];                // In der Zeile vorkommende Ziffern (Bit 0 = Ziffer 1)
+    digitMask columnMask[SIZE];             // In der Spalte vorkommende Ziffern
+    digitMask boxMask[SIZE];                // Im Block vorkommende Ziffern
+};
+
+// Bei 9x9 sind die Geometrietabellen fest eingetragen, bei anderen Größen werden sie beim Programmstart berechnet
+#if BOX_SIZE == 3
+#define GEOMETRY_CONST const
+#else
+#define GEOMETRY_CONST
+#endif
+
+// Zeile, Spalte und Block jedes Feldes
+extern GEOMETRY_CONST uint8_t rowOf[GRID_CELLS];
+extern GEOMETRY_CONST uint8_t columnOf[GRID_CELLS];
+extern GEOMETRY_CONST uint8_t boxOf[GRID_CELLS];
+
+// Felder jeder Einheit (Zeilen, danach Spalten, danach Blöcke)
+extern GEOMETRY_CONST cellIndex unitCells[UNITS][SIZE];
+
+/**
+ * Funktion:        charToValue
+ *
+ * Parameter:       charakter (int) -> Eingelesenes Zeichen
+ *
+ * Rückgabewert:    Gibt die Ziffer zurück (0 für '0' und '.'), -1 bei einem ungültigen Zeichen
+ *
+ * Beschreibung:    Wandelt ein Zeichen in eine Ziffer um. Ab 10 werden Buchstaben verwendet (A = 10, Groß- und Kleinschreibung egal).
+ */
+static inline int charToValue(int charakter) {
+    int value;
+
+    if (charakter == '.' || charakter == '0') {
+        return 0;
+    }
+
+    if (charakter >= '1' && charakter <= '9') {
+        value = charakter - '0';
+    } else if (toupper(charakter) >= 'A' && toupper(charakter) <= 'Z') {
+        value = toupper(charakter) - 'A' + 10;
+    } else {
+        return -1;
+    }
+
+    return value <= SIZE ? value : -1;
+}
+
+/**
+ * Funktion:        valueToChar
+ *
+ * Parameter:       value (int) -> Ziffer (0 = leer, 1 - SIZE)
+ *
+ * Rückgabewert:    Gibt das Zeichen der Ziffer zurück ('.' für ein leeres Feld)
+ *
+ * Beschreibung:    Gegenstück zu 'charToValue'.
+ */
+static inline char valueToChar(int value) {
+    return value == 0 ? '.' : DIGIT_CHARACTERS[value - 1];
+}
+
+// Spielfeldfunktionen
+void initBoard(struct board *board);
+void setBoardValue(struct board *board, int cell, int value);
+int isBoardGiven(const struct board *board, int cell);
+void setBoardGiven(struct board *board, int cell, int given);
+digitMask getBoardCandidates(const struct board *board, int cell);
+// Konvertierung zwischen 'struct sudoku' und 'struct board'
+void boardFromSudoku(const struct sudoku *sudokuGrid, struct board *board);
+void boardToSudoku(const struct board *board, struct sudoku *sudokuGrid);
+
+#endif // BOARD_H_INCLUDED
@@ -0,0 +1,13 @@
+#ifndef CONSOLE_H_INCLUDED
+#define CONSOLE_H_INCLUDED
+
+#include "sudoku.h"
+
+// Konsolenfunktionen: einzige plattformabhängige Stelle der Oberfläche (Windows-Konsole oder POSIX-Terminal)
+void initConsole();
+int getConsoleRows();
+int readKey();
+void readLine(char inputString[]);
+void die();
+
+#endif // CONSOLE_H_INCLUDED
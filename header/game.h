@@ -0,0 +1,29 @@
+#ifndef GAME_H_INCLUDED
+#define GAME_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Laufender Spielstand mit inkrementell gepflegten Zählern, damit Zugprüfung und Lösungserkennung O(1) sind
+struct game {
+    struct board board;                  // Aktueller Spielfortschritt
+    struct board solution;               // Lösung des Sudokus
+    uint8_t unitCount[UNITS][SIZE + 1];  // Häufigkeit jeder Ziffer je Einheit (Zeilen, danach Spalten, danach Blöcke)
+    int conflicts;                       // Summe aller überzähligen Ziffern in allen Einheiten
+    int emptyCount;                      // Anzahl der leeren Felder
+    cellIndex emptyCells[GRID_CELLS];    // Leere Felder, dicht gepackt in den ersten 'emptyCount' Einträgen (Reihenfolge beliebig)
+    cellIndex emptyPosition[GRID_CELLS]; // Position jedes leeren Feldes in 'emptyCells' (für gefüllte Felder bedeutungslos)
+    double pastTime;                     // Bislang benötigte Zeit in Sekunden
+};
+
+// Spielstandfunktionen
+void initGame(struct game *game, const struct savegame *sudoku);
+void gameToSavegame(const struct game *game, struct savegame *sudoku);
+void alterGameValue(struct game *game, struct field field, int newValue, int *error);
+void playGameMove(struct game *game, struct journal *journal, struct field field, int newValue, uint32_t time, int *error);
+int undoGameMove(struct game *game, struct journal *journal);
+int redoGameMove(struct game *game, struct journal *journal);
+void fillGameRandomField(struct game *game, struct random *random);
+int isGameSolved(const struct game *game);
+int checkGameMove(const struct game *game, struct field field, int value);
+
+#endif // GAME_H_INCLUDED
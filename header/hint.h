@@ -0,0 +1,16 @@
+#ifndef HINT_H_INCLUDED
+#define HINT_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Hinweis auf den nächsten Zug
+struct hint {
+    int cell;      // Feld (zeilenweise, -1 = kein Hinweis möglich)
+    int value;     // Einzutragende Ziffer
+    int technique; // Schwierigste Technik bis zu diesem Feld (TECHNIQUE_NONE = aus der gespeicherten Lösung übernommen)
+};
+
+// Hinweisfunktionen
+int findGameHint(const struct game *game, struct hint *hint);
+
+#endif // HINT_H_INCLUDED
@@ -0,0 +1,97 @@
+#ifndef INSTRUMENT_H_INCLUDED
+#define INSTRUMENT_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Messpunkte im Kern. Nur mit -DSUDOKU_INSTRUMENT übersetzt, sonst werden alle INSTRUMENT_*-Makros zu nichts.
+//
+// Zähler werden je Thread ohne Sperre erhöht; die Bereiche der Threads bleiben nach deren Ende erhalten und werden erst
+// bei der Ausgabe addiert. Zeitmessungen umschließen einen Abschnitt mit INSTRUMENT_BEGIN und INSTRUMENT_END.
+// Ausgegeben wird bei Programmende und auf Anfrage mit INSTRUMENT_REPORT (z.B. sudoku-solve --report DATEI). Jeder
+// Abschnitt zwischen INSTRUMENT_BEGIN und INSTRUMENT_END darf nur über INSTRUMENT_END verlassen werden.
+
+// Zähler
+#define COUNTER_SHUFFLE_SWAPS 0     //! Vertauschungen beim Mischen (Fisher-Yates)
+#define COUNTER_GRIDS_GENERATED 1   //! Erzeugte vollständige Gitter
+#define COUNTER_CARVE_ATTEMPTS 2    //! Versuche, ein Feld beim Ausdünnen zu leeren
+#define COUNTER_CARVE_RETRIES 3     //! Neue Durchläufe von 'makeSodukoPlayableRated'
+#define COUNTER_UNIQUENESS_CHECKS 4 //! Lösungszählungen (countGridSolutions)
+#define COUNTER_SOLVER_CALLS 5      //! Lösungen (solveGrid)
+#define COUNTER_RATINGS 6           //! Bewertungen (ratePuzzle)
+#define COUNTER_BOARD_SCANS 7       //! Prüfungen eines ganzen Gitters (checkSudoku, checkGrid)
+#define COUNTER_VALUE_CHECKS 8      //! Prüfungen eines Feldes (checkValue)
+#define COUNTER_PUZZLES_PARSED 9    //! Eingelesene Rätsel (readPuzzle)
+#define COUNTER_FILE_OPENS 10       //! Geöffnete Dateien
+#define COUNTER_FILE_READS 11       //! Lesezugriffe
+#define COUNTER_FILE_WRITES 12      //! Schreibzugriffe
+#define COUNTER_COUNT 13
+
+// Zeitmessungen
+#define TIMER_GENERATE 0     //! generateFullSudoku
+#define TIMER_CARVE 1        //! makeSodukoPlayable*
+#define TIMER_RATE 2         //! ratePuzzle
+#define TIMER_VALIDATE 3     //! checkSudoku, checkSudokuBatch
+#define TIMER_PARSE 4        //! Öffnen und Einlesen von Rätseldateien
+#define TIMER_SAVEGAME_IO 5  //! Lesen und Schreiben von Spielständen
+#define TIMER_COUNT 6
+
+// Umgebungsvariable mit der Datei, in die bei Programmende ausgegeben wird (sonst stderr)
+#define INSTRUMENT_FILE_VARIABLE "SUDOKU_INSTRUMENT_FILE"
+
+#ifdef SUDOKU_INSTRUMENT
+
+#include <stdatomic.h>
+
+// Zeitmessung eines Abschnitts
+struct instrumentTimer {
+    atomic_uint_fast64_t calls;
+    atomic_uint_fast64_t total;   // Nanosekunden
+    atomic_uint_fast64_t maximum; // Nanosekunden
+};
+
+// Messwerte eines Threads. Nur der Thread selbst schreibt, die Ausgabe liest (daher atomar, aber ohne Sperre).
+struct instrumentSlot {
+    atomic_uint_fast64_t counter[COUNTER_COUNT];
+    struct instrumentTimer timer[TIMER_COUNT];
+    struct instrumentSlot *next;
+};
+
+extern _Thread_local struct instrumentSlot *instrumentSlot;
+
+// Instrumentierungsfunktionen
+struct instrumentSlot *registerInstrumentSlot();
+void addInstrumentTime(int timer, uint64_t nanoseconds);
+void writeInstrumentReport(FILE *fileHandle);
+
+/**
+ * Funktion:        countInstrumentEvent
+ *
+ * Parameter:       counter (int)     -> COUNTER_* Konstante
+ * Parameter:       amount (uint64_t) -> Wert, um den erhöht wird
+ *
+ * Beschreibung:    Erhöht einen Zähler des eigenen Threads (ohne Sperre und ohne atomaren Lese-Schreib-Befehl).
+ */
+static inline void countInstrumentEvent(int counter, uint64_t amount) {
+    struct instrumentSlot *slot = instrumentSlot != NULL ? instrumentSlot : registerInstrumentSlot();
+    uint_fast64_t value = atomic_load_explicit(&slot->counter[counter], memory_order_relaxed);
+
+    atomic_store_explicit(&slot->counter[counter], value + amount, memory_order_relaxed);
+
+    return;
+}
+
+#define INSTRUMENT_COUNT(counter, amount) countInstrumentEvent((counter), (uint64_t) (amount))
+#define INSTRUMENT_BEGIN(timer) uint64_t instrumentStart##timer = getMonotonicTime()
+#define INSTRUMENT_END(timer) addInstrumentTime((timer), getMonotonicTime() - instrumentStart##timer)
+#define INSTRUMENT_REPORT(fileHandle) writeInstrumentReport(fileHandle)
+
+#else
+
+#define INSTRUMENT_COUNT(counter, amount) ((void) 0)
+#define INSTRUMENT_BEGIN(timer) ((void) 0)
+#define INSTRUMENT_END(timer) ((void) 0)
+#define INSTRUMENT_REPORT(fileHandle) ((void) 0)
+
+#endif // SUDOKU_INSTRUMENT
+
+#endif // INSTRUMENT_H_INCLUDED
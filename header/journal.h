@@ -0,0 +1,37 @@
+#ifndef JOURNAL_H_INCLUDED
+#define JOURNAL_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Kapazität beim ersten Zug und Obergrenze des Verlaufs (Zweierpotenzen). Ist die Obergrenze erreicht, wird der älteste
+// Zug verworfen.
+#define JOURNAL_INITIAL_CAPACITY 64
+#define JOURNAL_MAX_MOVES 4096
+
+// Ein Zug: nur die Änderung eines Feldes, nie das ganze Spielfeld
+struct move {
+    cellIndex cell;   // Index des Feldes
+    uint8_t oldValue; // Wert vor dem Zug (0 = leer)
+    uint8_t newValue; // Wert nach dem Zug (0 = leer)
+    uint32_t time;    // Bis zum Zug benötigte Zeit in Millisekunden
+};
+
+// Zugverlauf als wachsender Ringpuffer. Die ersten 'position' Züge (ab dem ältesten) sind angewendet, die übrigen wurden
+// rückgängig gemacht und können wiederholt werden.
+struct journal {
+    struct move *moves; // NULL bis zum ersten Zug
+    int capacity;
+    int first;          // Index des ältesten Zugs in 'moves'
+    int count;          // Anzahl der gespeicherten Züge
+    int position;       // Anzahl der angewendeten Züge
+};
+
+// Verlaufsfunktionen
+void initJournal(struct journal *journal);
+void freeJournal(struct journal *journal);
+int recordMove(struct journal *journal, int cell, int oldValue, int newValue, uint32_t time);
+const struct move *getJournalMove(const struct journal *journal, int index);
+const struct move *undoMove(struct journal *journal);
+const struct move *redoMove(struct journal *journal);
+
+#endif // JOURNAL_H_INCLUDED
@@ -0,0 +1,19 @@
+#ifndef PUZZLEPOOL_H_INCLUDED
+#define PUZZLEPOOL_H_INCLUDED
+
+#include "sudoku.h"
+
+// Datei, in der der Vorrat beim Beenden gespeichert und beim nächsten Start geladen wird
+#define POOL_FILE "puzzles.pool"
+
+// Plätze je Schwierigkeitsgrad (Zweierpotenz) und Füllstand, ab dem nachgefüllt wird
+#define POOL_CAPACITY 16
+#define POOL_LOW_WATER 8
+
+// Vorratsfunktionen
+void startPuzzlePool(uint64_t seed);
+int takePooledPuzzle(int difficulty, struct savegame *sudoku);
+int getPooledPuzzleCount(int difficulty);
+void stopPuzzlePool();
+
+#endif // PUZZLEPOOL_H_INCLUDED
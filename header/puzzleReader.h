@@ -0,0 +1,33 @@
+#ifndef PUZZLEREADER_H_INCLUDED
+#define PUZZLEREADER_H_INCLUDED
+
+#include "sudokuCore.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// Rückgabewerte von readPuzzle
+#define READER_PUZZLE 1 //! Ein Rätsel wurde gelesen
+#define READER_END 0 //! Ende der Datei erreicht
+#define READER_ERROR -1 //! Ungültige Eingabe, die Zeile steht in 'line'
+
+// In den Speicher eingeblendete Datei mit beliebig vielen Rätseln
+struct puzzleReader {
+    const char *data;
+    size_t size;
+    size_t position;
+    int line;
+    int skipped; // Nach einem Fehler übersprungene Zeilen, die erst beim nächsten Aufruf gezählt werden
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+};
+
+// Lesefunktionen
+int openPuzzleReader(struct puzzleReader *reader, const char *path);
+int readPuzzle(struct puzzleReader *reader, uint8_t grid[GRID_CELLS], uint8_t solution[GRID_CELLS], int *hasSolution);
+void closePuzzleReader(struct puzzleReader *reader);
+
+#endif // PUZZLEREADER_H_INCLUDED
@@ -0,0 +1,17 @@
+#ifndef RANDOM_H_INCLUDED
+#define RANDOM_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Zustand eines Zufallsgenerators (xoshiro256**). Jeder Thread bzw. jede Instanz hat ihren eigenen Zustand.
+struct random {
+    uint64_t state[4];
+};
+
+// Zufallsfunktionen (ersetzen rand()/srand())
+void seedRandom(struct random *random, uint64_t seed);
+uint64_t getRandom64(struct random *random);
+int getRandomBelow(struct random *random, int bound);
+struct random *getSessionRandom();
+
+#endif // RANDOM_H_INCLUDED
@@ -0,0 +1,64 @@
+#ifndef RATING_H_INCLUDED
+#define RATING_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Lösungstechniken in aufsteigender Schwierigkeit (Reihenfolge = Reihenfolge, in der sie probiert werden)
+#define TECHNIQUE_NONE 0
+#define TECHNIQUE_NAKED_SINGLE 1
+#define TECHNIQUE_HIDDEN_SINGLE 2
+#define TECHNIQUE_LOCKED_CANDIDATES 3
+#define TECHNIQUE_NAKED_PAIR 4
+#define TECHNIQUE_HIDDEN_PAIR 5
+#define TECHNIQUE_NAKED_TRIPLE 6
+#define TECHNIQUE_HIDDEN_TRIPLE 7
+#define TECHNIQUE_X_WING 8
+#define TECHNIQUE_SWORDFISH 9
+#define TECHNIQUE_XY_WING 10
+#define TECHNIQUE_XY_CHAIN 11
+#define TECHNIQUE_COUNT 12
+
+// Höchstzahl an Schritten je Rätsel, danach gilt es als nicht mit Techniken lösbar (Zeitbudget, unabhängig vom Rechner)
+#define RATING_STEP_BUDGET (500 * GRID_CELLS / 81)
+
+// Anzahl der Versuche, ein Sudoku mit dem gewünschten Schwierigkeitsgrad zu erzeugen (siehe 'makeSodukoPlayableRated')
+#define RATING_ATTEMPTS 20
+
+// Anzahl weiterer leerer Felder zwischen zwei Bewertungen beim Ausdünnen (siehe 'makeSodukoPlayableRated')
+#define RATING_CARVE_STEP 4
+
+// Gitter mit Kandidaten, wie es ein menschlicher Spieler mit Notizen führt
+struct ratingGrid {
+    uint8_t value[GRID_CELLS];        // Werte (0 = leer)
+    digitMask candidates[GRID_CELLS]; // Verbleibende Kandidaten leerer Felder (Bit 0 = Ziffer 1, 0 bei gefüllten Feldern)
+    int emptyCount;
+};
+
+// Ein einzelner logischer Schritt
+struct ratingStep {
+    int technique;    // TECHNIQUE_*
+    int cell;         // Gesetztes Feld (-1 = es wurden nur Kandidaten gestrichen)
+    int value;        // Gesetzte Ziffer
+    int eliminations; // Anzahl gestrichener Kandidaten
+};
+
+// Ergebnis einer Bewertung
+struct rating {
+    int score;                  // Summe der Gewichte aller Schritte
+    int hardest;                // Schwierigste benötigte Technik
+    int steps;                  // Anzahl der Schritte
+    int solved;                 // 1 = vollständig mit Techniken gelöst, 0 = Techniken oder Budget reichen nicht
+    int uses[TECHNIQUE_COUNT];  // Anzahl der Schritte je Technik
+};
+
+// Bewertungsfunktionen
+int initRatingGrid(struct ratingGrid *grid, const uint8_t values[GRID_CELLS]);
+void initRatingGridFromBoard(struct ratingGrid *grid, const struct board *board);
+int applyRatingStep(struct ratingGrid *grid, struct ratingStep *step);
+int ratePuzzle(const uint8_t values[GRID_CELLS], int stepBudget, struct rating *rating);
+int ratePuzzleDifficulty(const uint8_t values[GRID_CELLS], int stepBudget);
+int rateSudoku(const struct sudoku *sudokuGrid, struct rating *rating);
+int ratingToDifficulty(const struct rating *rating);
+const char *getTechniqueName(int technique);
+
+#endif // RATING_H_INCLUDED
@@ -0,0 +1,38 @@
+#ifndef RENDERER_H_INCLUDED
+#define RENDERER_H_INCLUDED
+
+#include "sudoku.h"
+
+// Größe des Bildpuffers: Ein ganzes Bild einschließlich Farben passt hinein und wird mit einem Schreibaufruf ausgegeben
+#define FRAME_BUFFER_SIZE 16384
+
+// Anzahl der Bildschirmzeilen des Spielfeldes (Spaltenbeschriftung, Rahmen und SIZE Zeilen)
+#define GRID_LINES (SIZE + BOX_SIZE + 2)
+
+// Breite der Zeilennummern links vom Spielfeld
+#define ROW_LABEL_WIDTH (SIZE > 9 ? 2 : 1)
+
+// ANSI/VT-Steuersequenzen
+#define VT_CLEAR "\x1b[H\x1b[2J"      // Cursor nach oben links, Bildschirm leeren
+#define VT_CLEAR_BELOW "\x1b[J"       // Ab dem Cursor bis zum Ende des Bildschirms leeren
+#define VT_COLOR_GIVEN "\x1b[93m"     // Vorgegebene Felder: hellgelb
+#define VT_COLOR_PLAYER "\x1b[97m"    // Eingetragene Felder: hellweiß
+#define VT_COLOR_RESET "\x1b[0m"
+
+// Zuletzt dargestelltes Spielfeld, damit nach einem Zug nur geänderte Felder neu gezeichnet werden
+struct gridView {
+    struct board shown; // Stand auf dem Bildschirm
+    int top;            // Bildschirmzeile der Spaltenbeschriftung (ab 1)
+    int valid;          // 0 = Spielfeld steht nicht (mehr) auf dem Bildschirm
+};
+
+// Ausgabefunktionen
+void initRenderer();
+void clearScreen();
+void flushScreen();
+void moveCursor(int row, int column);
+void drawGrid(struct gridView *view, const struct board *board, int top);
+void updateGrid(struct gridView *view, const struct board *board);
+int fitsScreen(const struct gridView *view, int linesBelow);
+
+#endif // RENDERER_H_INCLUDED
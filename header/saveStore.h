@@ -0,0 +1,49 @@
+#ifndef SAVESTORE_H_INCLUDED
+#define SAVESTORE_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Datei mit allen Spielständen und temporäre Datei beim Verdichten
+#define SAVESTORE_FILE "savegames.skram"
+#define SAVESTORE_TEMP_FILE "savegames.tmp"
+
+// Aufbau der Datei (alle Zahlen little-endian):
+//   0     "SKST", uint16 Version, uint16 reserviert, uint32 Kapazität, uint32 Anzahl der Spielstände
+//   16    Index mit 'Kapazität' Einträgen zu je 64 Bytes (siehe struct saveEntry)
+//   ...   Spielstände im Format aus savegame.h. Ein neuer Spielstand belegt die erste Lücke zwischen den gültigen
+//         Spielständen, in die er passt (sonst wird er angehängt); ist beim Öffnen mehr Platz ungenutzt als belegt,
+//         wird die Datei verdichtet.
+#define SAVESTORE_VERSION 1
+#define SAVESTORE_HEADER_SIZE 16
+#define SAVESTORE_ENTRY_SIZE 64
+#define SAVESTORE_CAPACITY 4096
+#define SAVESTORE_NAME_LENGTH 40
+
+// Eintrag im Index: alle Angaben, die zum Auflisten benötigt werden, ohne den Spielstand selbst zu lesen
+struct saveEntry {
+    char name[SAVESTORE_NAME_LENGTH]; // Mit '\0' abgeschlossen
+    int difficulty;                   // EASY, MEDIUM, DIFFICULT (0 = unbekannt)
+    int progress;                     // Ausgefüllte Felder in Prozent der nicht vorgegebenen Felder
+    uint32_t pastTime;                // Bislang benötigte Zeit in Millisekunden
+    uint32_t offset;                  // Position des Spielstands in der Datei
+    uint32_t length;                  // Länge des Spielstands in Bytes
+    uint32_t savedAt;                 // Zeitpunkt des Speicherns (Sekunden seit 1970)
+};
+
+// Geöffnete Datei mit eingelesenem Index
+struct saveStore {
+    FILE *fileHandle;
+    int capacity;
+    int count;
+    struct saveEntry *entries;
+};
+
+// Funktionen der Spielstand-Datei
+int openSaveStore(struct saveStore *store);
+void closeSaveStore(struct saveStore *store);
+int findStoredSave(const struct saveStore *store, const char *name);
+int readStoredSave(struct saveStore *store, int index, struct savegame *sudoku, struct journal *journal);
+int writeStoredSave(struct saveStore *store, const char *name, const struct savegame *sudoku, const struct journal *journal);
+int deleteStoredSave(struct saveStore *store, int index);
+
+#endif // SAVESTORE_H_INCLUDED
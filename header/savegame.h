@@ -0,0 +1,49 @@
+#ifndef SAVEGAME_H_INCLUDED
+#define SAVEGAME_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Binärformat eines Spielstands (alle Zahlen little-endian, Größen für 9x9):
+//   0   "SKRM"                 Kennung
+//   4   uint8                  Version
+//   5   uint8                  Schwierigkeitsgrad (0 = unbekannt)
+//   6   uint8                  Blockgröße (0 = 3, sonst BOX_SIZE)
+//   7   uint8                  Reserviert (0)
+//   8   uint32                 Bislang benötigte Zeit in Millisekunden
+//   12  uint8[41]              Lösung, zwei Felder je Byte (unteres Halbbyte zuerst, ab 16x16 ein Feld je Byte)
+//   53  uint8[41]              Spielfortschritt, ebenso gepackt
+//   94  uint8[11]              Bitmaske der vorgegebenen Felder (Bit 0 = Feld 0)
+//   105 uint32                 Anzahl der Züge im Verlauf (ab Version 2)
+//   109 uint32                 Anzahl der angewendeten Züge (die übrigen wurden rückgängig gemacht)
+//   113 je Zug 8 Bytes         uint16 Feld, uint8 alter Wert, uint8 neuer Wert, uint32 Zeit in Millisekunden (ältester zuerst)
+//   ... uint32                 CRC-32 über alle vorherigen Bytes
+// Version 1 endet nach der Bitmaske mit der CRC-32 und wird weiterhin (ohne Verlauf) gelesen.
+#define SAVEGAME_VERSION 2
+#define SAVEGAME_GEOMETRY (BOX_SIZE == 3 ? 0 : BOX_SIZE)
+#define SAVEGAME_CELL_BITS (SIZE < 16 ? 4 : 8)
+#define SAVEGAME_PACKED_GRID ((GRID_CELLS * SAVEGAME_CELL_BITS + 7) / 8)
+#define SAVEGAME_GIVEN_MASK ((GRID_CELLS + 7) / 8)
+#define SAVEGAME_BOARD_END (12 + 2 * SAVEGAME_PACKED_GRID + SAVEGAME_GIVEN_MASK)
+#define SAVEGAME_MOVE_SIZE 8
+#define SAVEGAME_V1_SIZE (SAVEGAME_BOARD_END + 4)
+
+// Größe eines Spielstands ohne bzw. mit 'moves' Zügen im Verlauf
+#define SAVEGAME_SIZE (SAVEGAME_BOARD_END + 8 + 4)
+#define SAVEGAME_JOURNAL_SIZE(moves) (SAVEGAME_SIZE + (size_t) (moves) * SAVEGAME_MOVE_SIZE)
+
+// Größter Spielstand ohne Verlauf, der beim Laden gelesen wird (altes Textformat: 324 Ziffern, Zeilenumbruch, Zeit)
+#define SAVEGAME_MAX_SIZE (SAVEGAME_SIZE > 512 ? SAVEGAME_SIZE : 512)
+
+// Kodierung der Spielstände
+size_t getSavegameSize(const struct journal *journal);
+size_t encodeSavegame(const struct savegame *sudoku, const struct journal *journal, uint8_t *buffer);
+int decodeSavegame(const uint8_t *buffer, size_t length, struct savegame *sudoku, struct journal *journal);
+uint32_t getCrc32(const void *data, size_t length);
+void writeUint32(uint8_t *buffer, uint32_t value);
+uint32_t readUint32(const uint8_t *buffer);
+
+// Sicheres Schreiben von Dateien
+int syncFile(FILE *fileHandle);
+int replaceFile(const char *source, const char *target);
+
+#endif // SAVEGAME_H_INCLUDED
@@ -0,0 +1,18 @@
+#ifndef SOLVER_H_INCLUDED
+#define SOLVER_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Höchstzahl an Verzweigungen je Eindeutigkeitsprüfung beim Ausdünnen (9x9 braucht selten mehr als 10)
+#define CARVE_BRANCH_BUDGET 100L
+
+// Löserfunktionen
+int solveGrid(const unsigned char grid[GRID_CELLS], unsigned char solution[GRID_CELLS]);
+int solveSudoku(const struct sudoku *sudokuGrid, struct sudoku *solution);
+int solveGridUnique(const unsigned char grid[GRID_CELLS], unsigned char solution[GRID_CELLS]);
+int countGridSolutions(const unsigned char grid[GRID_CELLS], int limit);
+int countGridSolutionsWithin(const unsigned char grid[GRID_CELLS], int limit, long budget);
+int hasOtherSolutionWithin(const unsigned char grid[GRID_CELLS], const unsigned char solution[GRID_CELLS], int cell, long budget);
+void generateGrid(struct random *random, unsigned char grid[GRID_CELLS]);
+
+#endif // SOLVER_H_INCLUDED
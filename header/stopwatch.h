@@ -0,0 +1,24 @@
+#ifndef STOPWATCH_H_INCLUDED
+#define STOPWATCH_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Anzahl der Stufen im Latenz-Histogramm (je Zweierpotenz 16 Unterteilungen)
+#define HISTOGRAM_BUCKETS (60 * 16)
+
+// Logarithmisches Histogramm für Laufzeiten in Nanosekunden (relativer Fehler höchstens 1/16)
+struct histogram {
+    uint64_t count[HISTOGRAM_BUCKETS];
+    uint64_t total;
+    uint64_t maximum;
+};
+
+// Zeitmessung
+uint64_t getMonotonicTime();
+// Histogrammfunktionen
+void initHistogram(struct histogram *histogram);
+void addToHistogram(struct histogram *histogram, uint64_t nanoseconds);
+void mergeHistogram(struct histogram *target, const struct histogram *source);
+uint64_t getHistogramPercentile(const struct histogram *histogram, double percentile);
+
+#endif // STOPWATCH_H_INCLUDED
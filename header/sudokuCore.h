@@ -0,0 +1,152 @@
+#ifndef SUDOKUCORE_H_INCLUDED
+#define SUDOKUCORE_H_INCLUDED
+
+// Plattformunabhängiger Kern (libsudoku): Generierung, Prüfung, Lösen, Bewertung, Einlesen und Spielstände.
+// Enthält keine Konsolen- oder Windows-Abhängigkeiten, siehe sudoku.h für die Oberfläche.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <math.h>
+#include <ctype.h>
+
+
+// Definition von Konstaten für den Schwierigkeitsgrad
+#define EASY 1
+#define MEDIUM 2
+#define DIFFICULT 3
+
+// Generatoren für vollständige Sudokus
+#define GENERATOR_PATTERN 1 //! Grundmuster mit zufälliger Symmetrietransformation
+#define GENERATOR_BACKTRACK 2 //! Zufällige Tiefensuche, erreicht alle gültigen Gitter
+#define DEFAULT_GENERATOR GENERATOR_BACKTRACK
+
+// Parser Konstanten
+#define PARSER_VALID 0 //! Parsing erfolgreich
+#define PARSER_FILE_INACCESSIBLE 1 //! Datei nicht lesbar
+#define PARSER_SUDOKU_NUMBERS_INVALID 2 //! Sudoku enthielt falsch Eingaben.
+#define PARSER_SUDOKU_INVALID 3 //! Vorgegebene Ziffern widersprechen sich
+#define PARSER_SUDOKU_UNSOLVABLE 4 //! Rätsel hat keine Lösung
+#define PARSER_SUDOKU_AMBIGUOUS 5 //! Rätsel hat mehrere Lösungen
+
+// Definition von Konstante für maximale Zeichenkettenlänge
+#define STRLEN 1024
+
+// Kantenlänge eines Blocks, beim Übersetzen wählbar (-DBOX_SIZE=2 / 3 / 4 / 5 für 4x4, 9x9, 16x16, 25x25)
+#ifndef BOX_SIZE
+#define BOX_SIZE 3
+#endif
+
+#if BOX_SIZE < 2 || BOX_SIZE > 5
+#error "BOX_SIZE muss zwischen 2 und 5 liegen"
+#endif
+
+// Definition von horizontaler sowie vertikaler Sudoku-Größe
+#define SIZE (BOX_SIZE * BOX_SIZE)
+
+// Anzahl der Felder in einem flachen Sudoku-Gitter (zeilenweise, 0 = leer)
+#define GRID_CELLS (SIZE * SIZE)
+
+// Anzahl der Einheiten (Zeilen, Spalten, Blöcke)
+#define UNITS (3 * SIZE)
+
+// Bitmaske von Ziffern (Bit 0 = Ziffer 1) und Index eines Feldes, jeweils so schmal wie möglich
+#if SIZE <= 16
+typedef uint16_t digitMask;
+#else
+typedef uint32_t digitMask;
+#endif
+
+#if GRID_CELLS <= 256
+typedef uint8_t cellIndex;
+#else
+typedef uint16_t cellIndex;
+#endif
+
+// Bitmaske aller Ziffern 1 - SIZE
+#define ALL_DIGITS ((digitMask) ((1UL << SIZE) - 1))
+
+// Zeichen der Ziffern 1 - SIZE (ab 10 Buchstaben)
+#define DIGIT_CHARACTERS "123456789ABCDEFGHIJKLMNOP"
+
+
+// Sudoku-Gitter
+struct sudoku {
+    int value[SIZE][SIZE];     // Werte im Sudoku
+    int generated[SIZE][SIZE]; // 1 = Wert kann nicht geändert werden, 0 = Wert kann geändert werden
+};
+
+// Koordinaten eines Feldes im Sudoku-Gitter
+struct field {
+    int row;
+    int column;
+};
+
+// Struktur für einen gespeicherten Spielstand
+struct savegame {
+    struct sudoku sudokuGridSolved;
+    struct sudoku sudokuGrid;
+    double pastTime;
+    int difficulty; // EASY, MEDIUM, DIFFICULT (0 = unbekannt)
+};
+
+// Zufallsgenerator (siehe random.h)
+struct random;
+
+// Zugverlauf (siehe journal.h)
+struct journal;
+
+// Savegame-Funktionen
+struct savegame readSavegame(int slot, int *error);
+// Funktionsprototypen (Funktionsbeschreibungen jeweils an den Funktionen)
+// Funktion zum Initialisieren
+void init(uint64_t seed);
+// Sudoku Generierungsfunktionen
+struct sudoku generateFullSudoku(struct random *random, int generator);
+struct sudoku makeSodukoPlayable(struct sudoku sudokuGrid, int difficulty, struct random *random);
+struct sudoku makeSodukoPlayableUnique(struct sudoku sudokuGrid, int difficulty, struct random *random);
+struct sudoku makeSodukoPlayableRated(struct sudoku sudokuGrid, int difficulty, struct random *random);
+int getEmptyFieldsForDifficulty(int difficulty);
+// Funktionen zum Mischen und Vertauschen von Werten (Zeilen/Spalten siehe transform.h)
+void shuffle(int array[], int size, struct random *random);
+void swap(int *x, int *y);
+// Funktionen zum Prüfen des Sudokus
+int checkSudoku(struct sudoku sudokuGrid);
+int checkValue(struct sudoku sudokuGrid, struct field field);
+int checkRow(struct sudoku sudokuGrid, struct field field);
+int checkColumn(struct sudoku sudokuGrid, struct field field);
+int checkGroup(struct sudoku sudokuGrid, struct field field);
+// Funktionen zum prüfen und Konvertieren von Eingaben
+int charToInt(char charakter);
+int checkAndConvertInputToInt(char inputString[]);
+int checkAndConvertInputChar(char inputString[]);
+// Feldfunktionen
+struct sudoku alterValue(struct sudoku sudokuGrid, struct field field, int newValue, int *error);
+struct sudoku fillRandomField(struct sudoku sudokuGridSolved, struct sudoku sudokuGrid, struct random *random);
+int countEmptyFields(struct sudoku sudokuGrid);
+// File parsing for custom sudoku
+struct sudoku getSudokuFromFile(char[1024], int*, int*, struct sudoku*);
+int checkParsedSudoku(struct sudoku);
+int solveParsedSudoku(struct sudoku, struct sudoku*);
+
+#include "displayTime.h"
+#include "board.h"
+#include "game.h"
+#include "solver.h"
+#include "validator.h"
+#include "random.h"
+#include "stopwatch.h"
+#include "instrument.h"
+#include "threadPool.h"
+#include "puzzleReader.h"
+#include "journal.h"
+#include "savegame.h"
+#include "saveStore.h"
+#include "autosave.h"
+#include "transform.h"
+#include "rating.h"
+#include "hint.h"
+
+#endif // SUDOKUCORE_H_INCLUDED
@@ -0,0 +1,13 @@
+#ifndef THREADPOOL_H_INCLUDED
+#define THREADPOOL_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Aufgabe eines Threads: bearbeitet die Aufgabe 'task' (0 - taskCount-1) auf dem Thread 'worker'
+typedef void (*taskFunction)(long long task, int worker, void *context);
+
+// Thread-Pool mit Work-Stealing
+int runTasks(long long taskCount, int threadCount, taskFunction function, void *context);
+int getProcessorCount();
+
+#endif // THREADPOOL_H_INCLUDED
@@ -0,0 +1,17 @@
+#ifndef TRANSFORM_H_INCLUDED
+#define TRANSFORM_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Element der Symmetriegruppe eines Sudokus als Tabelle: Feld i des Ergebnisses erhält die Ziffer digitMap[Wert von Feld cellMap[i]]
+struct transform {
+    cellIndex cellMap[GRID_CELLS];
+    uint8_t digitMap[SIZE + 1]; // digitMap[0] = 0 (leere Felder bleiben leer)
+};
+
+// Transformationsfunktionen
+void getRandomTransform(struct transform *transform, struct random *random);
+void applyTransform(const struct transform *transform, const uint8_t source[GRID_CELLS], uint8_t target[GRID_CELLS]);
+struct sudoku transformSudoku(const struct transform *transform, struct sudoku sudokuGrid);
+
+#endif // TRANSFORM_H_INCLUDED
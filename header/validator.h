@@ -0,0 +1,11 @@
+#ifndef VALIDATOR_H_INCLUDED
+#define VALIDATOR_H_INCLUDED
+
+#include "sudokuCore.h"
+
+// Batch-Prüfung vollständig ausgefüllter Sudokus (je Gitter 81 Bytes, zeilenweise, Werte 1 - 9)
+size_t checkSudokuBatch(const uint8_t *grids, size_t n, uint8_t *results);
+int checkGrid(const uint8_t grid[GRID_CELLS]);
+const char *getValidatorName();
+
+#endif // VALIDATOR_H_INCLUDED
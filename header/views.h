@@ -6,16 +6,20 @@
 
 #include "sudoku.h"
 
+struct saveStore;
+struct journal;
+
 // Ausgabe-/Viewfunktionen
 int showView(int view);
 int viewHome();
 int viewGameNew();
 int viewGameLoad();
-int viewGameDelete();
-int viewGamePlay(struct savegame);
-int viewGameSave(struct savegame);
+int viewGameDelete(struct saveStore *store);
+int viewGamePlay(struct savegame, struct journal *);
+int viewGameSave(struct savegame, const struct journal *);
 int viewGameReadFromSudokuFile();
+int viewGameRecover();
 int viewCredits();
-void printGrid(struct sudoku);
+void showParserErrorMessage(int, int);
 
 #endif // VIEWS_H_INCLUDED
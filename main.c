@@ -3,11 +3,14 @@
  *
  * Funktionsumfang:
  *
- * - Zufällig generiertes Sudoku nach Schwierigkeitsgrad
+ * - Zufällig generiertes Sudoku nach Schwierigkeitsgrad (im Hintergrund vorgeneriert, Vorrat wird beim Beenden gespeichert)
  * - Timer mit bislang benötigter Spielzeit nach jedem Zug und am Ende des Spiels
- * - Sudoku kann in einem Slot gespeichert werden (.skram-Datei)
- * - Sudoku kann aus einem Slot geladen und fortgesetzt werden (.skram-Datei)
- * - Während dem Spielen kann man mit der Tipp-Funktion ein zufällig gewähltes Feld automatisch füllen lassen
+ * - Sudokus können unter einem Namen gespeichert werden (samt Zugverlauf, alle in savegames.skram)
+ * - Gespeicherte Sudokus werden mit Schwierigkeitsgrad, Fortschritt und Zeit aus dem Index aufgelistet und können geladen,
+ *   fortgesetzt oder gelöscht werden (alte Slot-Dateien werden automatisch übernommen)
+ * - Jeder Zug wird automatisch gesichert, ein nicht beendetes Spiel wird beim nächsten Start angeboten
+ * - Während dem Spielen füllt die Tipp-Funktion das Feld, das sich mit der einfachsten Lösungstechnik ergibt, und nennt
+ *   die Technik (falsch eingetragene Werte werden vorher entfernt)
  * - Nach jedem Zug wird das Sudoku im Hintergrund geprüft
  * - Sobald das Sudoku vollständig und korrekt gelöst wurde, wird eine entsprechende Nachricht angezeigt
  * - Eigenes Sudoku kann aus einer beliebigen Textdatei eingelesen werden
@@ -18,10 +21,27 @@
 
 #include "header/sudoku.h"
 
-// Hauptprogramm
-int main() {
-    init();
-    int input = VIEW_HOME;
+// Hauptprogramm (Aufruf: sudoku [--seed N], gleicher Startwert = gleiche Sudokus)
+int main(int argc, char *argv[]) {
+    uint64_t seed = (uint64_t) time(NULL);
+    int fixedSeed = 0;
+
+    if (argc == 3 && strcmp(argv[1], "--seed") == 0) {
+        seed = (uint64_t) strtoull(argv[2], NULL, 10);
+        fixedSeed = 1;
+    }
+
+    init(seed);
+    initRenderer();
+
+    // Vorrat an fertigen Sudokus im Hintergrund füllen. Mit festem Startwert wird weiter direkt generiert,
+    // damit die Sudokus nicht von gespeicherten Vorräten oder der Laufzeit des Hintergrund-Threads abhängen.
+    if (!fixedSeed) {
+        startPuzzlePool(getRandom64(getSessionRandom()));
+    }
+
+    // Zuerst ein nicht beendetes Spiel aus der automatischen Sicherung anbieten
+    int input = VIEW_GAME_RECOVER;
 
     // Steuerung der Views / Bildschirme
     do {
@@ -46,10 +66,16 @@ int main() {
                 input = showView(VIEW_GAME_READ);
                 break;
 
+            case VIEW_GAME_RECOVER:
+                input = showView(VIEW_GAME_RECOVER);
+                break;
+
             default:
                 die();
         }
     } while (input != VIEW_EXIT);
 
+    stopPuzzlePool();
+
     return 0;
 }
@@ -0,0 +1,292 @@
+#include "../header/sudokuCore.h"
+
+/**
+ * Funktion:        writeAutosaveSnapshot
+ *
+ * Parameter:       autosave (struct autosave *)      -> Automatische Sicherung
+ * Parameter:       sudoku (const struct savegame *)  -> Aktueller Spielstand
+ * Parameter:       journal (const struct journal *)  -> Aktueller Zugverlauf
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn das Abbild geschrieben wurde, andernfalls eine 0 (Sicherung ist danach nicht aktiv)
+ *
+ * Beschreibung:    Fasst den Spielstand samt Verlauf zu einem neuen Abbild zusammen und beginnt ein leeres Protokoll. Das Abbild
+ *                  wird in eine temporäre Datei geschrieben und erst dann umbenannt. Bricht das Programm ab, bevor das
+ *                  Protokoll zurückgesetzt ist, passt dessen Kopf nicht mehr zum neuen Abbild und es wird beim Wiederherstellen
+ *                  ignoriert (alle Züge stehen dann schon im Abbild).
+ */
+int writeAutosaveSnapshot(struct autosave *autosave, const struct savegame *sudoku, const struct journal *journal) {
+    uint8_t *buffer, header[AUTOSAVE_HEADER_SIZE];
+    FILE *fileHandle;
+    size_t length;
+    int written;
+
+    if (autosave->log != NULL) {
+        fclose(autosave->log);
+        autosave->log = NULL;
+    }
+
+    if ((buffer = malloc(getSavegameSize(journal))) == NULL) {
+        return 0;
+    }
+
+    length = encodeSavegame(sudoku, journal, buffer);
+    autosave->snapshotCrc = readUint32(buffer + length - 4);
+
+    INSTRUMENT_BEGIN(TIMER_SAVEGAME_IO);
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 2);
+
+    fileHandle = fopen(AUTOSAVE_TEMP_FILE, "wb");
+    written = fileHandle != NULL && fwrite(buffer, 1, length, fileHandle) == length && syncFile(fileHandle);
+    free(buffer);
+
+    if (fileHandle != NULL) {
+        written = fclose(fileHandle) == 0 && written;
+    }
+
+    written = written && replaceFile(AUTOSAVE_TEMP_FILE, AUTOSAVE_SNAPSHOT_FILE);
+
+    if (!written) {
+        remove(AUTOSAVE_TEMP_FILE);
+    } else {
+        memcpy(header, "SKAL", 4);
+        writeUint32(header + 4, AUTOSAVE_VERSION);
+        writeUint32(header + 8, autosave->snapshotCrc);
+        writeUint32(header + 12, getCrc32(header, 12));
+
+        autosave->log = fopen(AUTOSAVE_LOG_FILE, "wb");
+        written = autosave->log != NULL && fwrite(header, 1, sizeof(header), autosave->log) == sizeof(header)
+                  && syncFile(autosave->log);
+    }
+
+    INSTRUMENT_END(TIMER_SAVEGAME_IO);
+
+    if (!written) {
+        stopAutosave(autosave, 0);
+        return 0;
+    }
+
+    autosave->unsynced = 0;
+    autosave->records = 0;
+
+    return 1;
+}
+
+/**
+ * Funktion:        startAutosave
+ *
+ * Parameter:       autosave (struct autosave *)      -> Enthält nach dem Funktionsaufruf die laufende Sicherung
+ * Parameter:       sudoku (const struct savegame *)  -> Spielstand zu Beginn
+ * Parameter:       journal (const struct journal *)  -> Zugverlauf zu Beginn
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Sicherung läuft, andernfalls eine 0 (das Spiel läuft dann ohne Sicherung)
+ *
+ * Beschreibung:    Ersetzt eine vorhandene Sicherung durch das erste Abbild des Spiels.
+ */
+int startAutosave(struct autosave *autosave, const struct savegame *sudoku, const struct journal *journal) {
+    memset(autosave, 0, sizeof(*autosave));
+
+    return writeAutosaveSnapshot(autosave, sudoku, journal);
+}
+
+/**
+ * Funktion:        logAutosave
+ *
+ * Parameter:       autosave (struct autosave *) -> Laufende Sicherung
+ * Parameter:       type (int)                   -> AUTOSAVE_MOVE, AUTOSAVE_UNDO oder AUTOSAVE_REDO
+ * Parameter:       cell (int)                   -> Index des Feldes (nur bei AUTOSAVE_MOVE)
+ * Parameter:       value (int)                  -> Neuer Wert (nur bei AUTOSAVE_MOVE)
+ * Parameter:       time (uint32_t)              -> Bis zum Zug benötigte Zeit in Millisekunden
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Eintrag geschrieben wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Hängt einen Eintrag fester Größe an das Protokoll an. Jeder Eintrag wird sofort an das Betriebssystem
+ *                  übergeben (übersteht einen Absturz des Programms), fsync erfolgt gesammelt alle AUTOSAVE_SYNC_RECORDS
+ *                  Einträge.
+ */
+int logAutosave(struct autosave *autosave, int type, int cell, int value, uint32_t time) {
+    uint8_t record[AUTOSAVE_RECORD_SIZE];
+
+    if (autosave->log == NULL) {
+        return 0;
+    }
+
+    record[0] = (uint8_t) cell;
+    record[1] = (uint8_t) (cell >> 8);
+    record[2] = (uint8_t) value;
+    record[3] = (uint8_t) type;
+    writeUint32(record + 4, time);
+    writeUint32(record + 8, getCrc32(record, 8));
+
+    INSTRUMENT_COUNT(COUNTER_FILE_WRITES, 1);
+
+    if (fwrite(record, 1, sizeof(record), autosave->log) != sizeof(record) || fflush(autosave->log) != 0) {
+        return 0;
+    }
+
+    autosave->records++;
+
+    if (++autosave->unsynced >= AUTOSAVE_SYNC_RECORDS) {
+        autosave->unsynced = 0;
+        return syncFile(autosave->log);
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        needsAutosaveSnapshot
+ *
+ * Parameter:       autosave (const struct autosave *) -> Laufende Sicherung
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn das Protokoll zu einem neuen Abbild zusammengefasst werden sollte, andernfalls eine 0
+ */
+int needsAutosaveSnapshot(const struct autosave *autosave) {
+    return autosave->log != NULL && autosave->records >= AUTOSAVE_SNAPSHOT_RECORDS;
+}
+
+/**
+ * Funktion:        stopAutosave
+ *
+ * Parameter:       autosave (struct autosave *) -> Laufende Sicherung
+ * Parameter:       discard (int)                -> 1 = Sicherung löschen (Spiel beendet), 0 = für die Wiederherstellung behalten
+ *
+ * Beschreibung:    Schreibt noch nicht synchronisierte Einträge und schließt das Protokoll.
+ */
+void stopAutosave(struct autosave *autosave, int discard) {
+    if (autosave->log != NULL) {
+        syncFile(autosave->log);
+        fclose(autosave->log);
+        autosave->log = NULL;
+    }
+
+    if (discard) {
+        remove(AUTOSAVE_LOG_FILE);
+        remove(AUTOSAVE_SNAPSHOT_FILE);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        replayAutosaveLog
+ *
+ * Parameter:       fileHandle (FILE *)         -> Geöffnetes Protokoll
+ * Parameter:       snapshotCrc (uint32_t)      -> CRC-32 des geladenen Abbilds
+ * Parameter:       game (struct game *)        -> Spielstand aus dem Abbild
+ * Parameter:       journal (struct journal *)  -> Zugverlauf aus dem Abbild
+ * Parameter:       time (uint32_t *)           -> Enthält nach dem Funktionsaufruf die Zeit des letzten Eintrags
+ *
+ * Rückgabewert:    Gibt die Anzahl der angewendeten Einträge zurück
+ *
+ * Beschreibung:    Wendet die Einträge in Reihenfolge an, bis zum ersten unvollständigen oder beschädigten Eintrag.
+ */
+static int replayAutosaveLog(FILE *fileHandle, uint32_t snapshotCrc, struct game *game, struct journal *journal, uint32_t *time) {
+    uint8_t header[AUTOSAVE_HEADER_SIZE], record[AUTOSAVE_RECORD_SIZE];
+    struct field field;
+    int count, cell, value, error;
+
+    if (fread(header, 1, sizeof(header), fileHandle) != sizeof(header) || memcmp(header, "SKAL", 4) != 0
+        || readUint32(header + 4) != AUTOSAVE_VERSION || readUint32(header + 8) != snapshotCrc
+        || readUint32(header + 12) != getCrc32(header, 12)) {
+        return 0;
+    }
+
+    count = 0;
+
+    while (fread(record, 1, sizeof(record), fileHandle) == sizeof(record) && readUint32(record + 8) == getCrc32(record, 8)) {
+        cell = record[0] | record[1] << 8;
+        value = record[2];
+
+        switch (record[3]) {
+            case AUTOSAVE_MOVE:
+                if (cell >= GRID_CELLS) {
+                    return count;
+                }
+
+                field.row = cell / SIZE;
+                field.column = cell % SIZE;
+                playGameMove(game, journal, field, value, readUint32(record + 4), &error);
+                break;
+
+            case AUTOSAVE_UNDO:
+                undoGameMove(game, journal);
+                break;
+
+            case AUTOSAVE_REDO:
+                redoGameMove(game, journal);
+                break;
+
+            default:
+                return count;
+        }
+
+        *time = readUint32(record + 4);
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * Funktion:        recoverAutosave
+ *
+ * Parameter:       sudoku (struct savegame *)  -> Enthält nach dem Funktionsaufruf den wiederhergestellten Spielstand
+ * Parameter:       journal (struct journal *)  -> Enthält nach dem Funktionsaufruf den wiederhergestellten Zugverlauf
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn ein nicht beendetes Spiel wiederhergestellt wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Lädt das Abbild und wendet das zugehörige Protokoll an (höchstens AUTOSAVE_SNAPSHOT_RECORDS Einträge,
+ *                  dauert daher nur Bruchteile einer Millisekunde). Die Dateien bleiben erhalten, bis das Spiel beendet ist.
+ */
+int recoverAutosave(struct savegame *sudoku, struct journal *journal) {
+    struct game game;
+    FILE *fileHandle;
+    uint8_t *buffer;
+    size_t length, maximum;
+    uint32_t time;
+    int valid;
+
+    INSTRUMENT_BEGIN(TIMER_SAVEGAME_IO);
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+
+    fileHandle = fopen(AUTOSAVE_SNAPSHOT_FILE, "rb");
+    maximum = SAVEGAME_JOURNAL_SIZE(JOURNAL_MAX_MOVES);
+    buffer = NULL;
+    length = 0;
+
+    if (fileHandle != NULL) {
+        buffer = malloc(maximum + 1);
+        INSTRUMENT_COUNT(COUNTER_FILE_READS, 1);
+        length = buffer != NULL ? fread(buffer, 1, maximum + 1, fileHandle) : 0;
+        fclose(fileHandle);
+    }
+
+    valid = length >= 4 && length <= maximum && decodeSavegame(buffer, length, sudoku, journal);
+
+    // Ohne gültiges Abbild wird das Protokoll nicht geöffnet
+    fileHandle = NULL;
+
+    if (valid) {
+        initGame(&game, sudoku);
+        time = (uint32_t) (sudoku->pastTime * 1000.0 + 0.5);
+
+        INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+        fileHandle = fopen(AUTOSAVE_LOG_FILE, "rb");
+    }
+
+    if (fileHandle != NULL) {
+        INSTRUMENT_COUNT(COUNTER_FILE_READS, 1);
+
+        if (replayAutosaveLog(fileHandle, readUint32(buffer + length - 4), &game, journal, &time) > 0) {
+            gameToSavegame(&game, sudoku);
+            sudoku->pastTime = time / 1000.0;
+        }
+
+        fclose(fileHandle);
+    }
+
+    free(buffer);
+    INSTRUMENT_END(TIMER_SAVEGAME_IO);
+
+    return valid;
+}
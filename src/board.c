@@ -0,0 +1,268 @@
+#include "../header/sudokuCore.h"
+
+#if BOX_SIZE == 3
+
+const uint8_t rowOf[GRID_CELLS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8
+};
+
+const uint8_t columnOf[GRID_CELLS] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3, 4, 5, 6, 7, 8
+};
+
+const uint8_t boxOf[GRID_CELLS] = {
+    0, 0, 0, 1, 1, 1, 2, 2, 2, 0, 0, 0, 1, 1, 1, 2, 2, 2, 0, 0, 0, 1, 1, 1, 2, 2, 2,
+    3, 3, 3, 4, 4, 4, 5, 5, 5, 3, 3, 3, 4, 4, 4, 5, 5, 5, 3, 3, 3, 4, 4, 4, 5, 5, 5,
+    6, 6, 6, 7, 7, 7, 8, 8, 8, 6, 6, 6, 7, 7, 7, 8, 8, 8, 6, 6, 6, 7, 7, 7, 8, 8, 8
+};
+
+// Felder der 27 Einheiten (9 Zeilen, 9 Spalten, 9 Blöcke)
+const cellIndex unitCells[UNITS][SIZE] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8},
+    {9, 10, 11, 12, 13, 14, 15, 16, 17},
+    {18, 19, 20, 21, 22, 23, 24, 25, 26},
+    {27, 28, 29, 30, 31, 32, 33, 34, 35},
+    {36, 37, 38, 39, 40, 41, 42, 43, 44},
+    {45, 46, 47, 48, 49, 50, 51, 52, 53},
+    {54, 55, 56, 57, 58, 59, 60, 61, 62},
+    {63, 64, 65, 66, 67, 68, 69, 70, 71},
+    {72, 73, 74, 75, 76, 77, 78, 79, 80},
+    {0, 9, 18, 27, 36, 45, 54, 63, 72},
+    {1, 10, 19, 28, 37, 46, 55, 64, 73},
+    {2, 11, 20, 29, 38, 47, 56, 65, 74},
+    {3, 12, 21, 30, 39, 48, 57, 66, 75},
+    {4, 13, 22, 31, 40, 49, 58, 67, 76},
+    {5, 14, 23, 32, 41, 50, 59, 68, 77},
+    {6, 15, 24, 33, 42, 51, 60, 69, 78},
+    {7, 16, 25, 34, 43, 52, 61, 70, 79},
+    {8, 17, 26, 35, 44, 53, 62, 71, 80},
+    {0, 1, 2, 9, 10, 11, 18, 19, 20},
+    {3, 4, 5, 12, 13, 14, 21, 22, 23},
+    {6, 7, 8, 15, 16, 17, 24, 25, 26},
+    {27, 28, 29, 36, 37, 38, 45, 46, 47},
+    {30, 31, 32, 39, 40, 41, 48, 49, 50},
+    {33, 34, 35, 42, 43, 44, 51, 52, 53},
+    {54, 55, 56, 63, 64, 65, 72, 73, 74},
+    {57, 58, 59, 66, 67, 68, 75, 76, 77},
+    {60, 61, 62, 69, 70, 71, 78, 79, 80}
+};
+
+#else
+
+uint8_t rowOf[GRID_CELLS];
+uint8_t columnOf[GRID_CELLS];
+uint8_t boxOf[GRID_CELLS];
+cellIndex unitCells[UNITS][SIZE];
+
+/**
+ * Funktion:        initGeometry
+ *
+ * Beschreibung:    Berechnet die Geometrietabellen für die beim Übersetzen gewählte Größe. Läuft vor 'main', damit auch
+ *                  die Werkzeuge und die Bibliothek die Tabellen ohne eigenen Aufruf verwenden können.
+ */
+__attribute__((constructor)) static void initGeometry() {
+    int cell, i;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        rowOf[cell] = (uint8_t) (cell / SIZE);
+        columnOf[cell] = (uint8_t) (cell % SIZE);
+        boxOf[cell] = (uint8_t) ((cell / SIZE / BOX_SIZE) * BOX_SIZE + (cell % SIZE) / BOX_SIZE);
+    }
+
+    for (i = 0; i < SIZE; i++) {
+        for (cell = 0; cell < SIZE; cell++) {
+            unitCells[i][cell] = (cellIndex) (i * SIZE + cell);
+            unitCells[SIZE + i][cell] = (cellIndex) (cell * SIZE + i);
+            unitCells[2 * SIZE + i][cell] = (cellIndex) ((i / BOX_SIZE) * BOX_SIZE * SIZE + (i % BOX_SIZE) * BOX_SIZE
+                                                         + (cell / BOX_SIZE) * SIZE + cell % BOX_SIZE);
+        }
+    }
+
+    return;
+}
+
+#endif
+
+/**
+ * Funktion:        initBoard
+ *
+ * Parameter:       board (struct board *) -> Spielfeld, welches geleert wird
+ *
+ * Beschreibung:    Erzeugt ein leeres Spielfeld ohne vorgegebene Felder.
+ */
+void initBoard(struct board *board) {
+    memset(board, 0, sizeof(*board));
+
+    return;
+}
+
+/**
+ * Funktion:        unitContains
+ *
+ * Parameter:       board (const struct board *) -> Spielfeld
+ * Parameter:       first (int)                  -> Erstes Feld der Einheit
+ * Parameter:       stride (int)                 -> Abstand zum nächsten Feld (1 = Zeile, SIZE = Spalte, 0 = Block)
+ * Parameter:       value (int)                  -> Gesuchte Ziffer
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Ziffer in der Einheit vorkommt, andernfalls eine 0
+ *
+ * Beschreibung:    Prüft eine einzelne Einheit auf eine Ziffer. Wird nur benötigt, wenn eine Ziffer aus einer Einheit entfernt wird,
+ *                  in der sie durch eine Fehleingabe doppelt stehen kann.
+ */
+static int unitContains(const struct board *board, int first, int stride, int value) {
+    int i;
+
+    for (i = 0; i < SIZE; i++) {
+        if (board->value[stride ? first + i * stride : first + (i / BOX_SIZE) * SIZE + i % BOX_SIZE] == value) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        setBoardValue
+ *
+ * Parameter:       board (struct board *) -> Spielfeld
+ * Parameter:       cell (int)             -> Index des Feldes (0 - GRID_CELLS - 1)
+ * Parameter:       value (int)            -> Neuer Wert (0 = leeren, 1 - SIZE)
+ *
+ * Beschreibung:    Schreibt einen Wert in ein Feld und hält die Belegungsmasken aktuell. Vorgegebene Felder werden hier nicht geprüft.
+ */
+void setBoardValue(struct board *board, int cell, int value) {
+    int row, column, box, oldValue;
+    digitMask bit;
+
+    row = rowOf[cell];
+    column = columnOf[cell];
+    box = boxOf[cell];
+    oldValue = board->value[cell];
+
+    if (oldValue == value) {
+        return;
+    }
+
+    board->value[cell] = (uint8_t) value;
+
+    // Alte Ziffer nur aus den Masken nehmen, wenn sie nicht noch ein zweites Mal in der Einheit steht
+    if (oldValue != 0) {
+        bit = (digitMask) ((digitMask) 1 << (oldValue - 1));
+
+        if (!unitContains(board, row * SIZE, 1, oldValue)) {
+            board->rowMask[row] &= ~bit;
+        }
+
+        if (!unitContains(board, column, SIZE, oldValue)) {
+            board->columnMask[column] &= ~bit;
+        }
+
+        if (!unitContains(board, unitCells[2 * SIZE + box][0], 0, oldValue)) {
+            board->boxMask[box] &= ~bit;
+        }
+    }
+
+    if (value != 0) {
+        bit = (digitMask) ((digitMask) 1 << (value - 1));
+        board->rowMask[row] |= bit;
+        board->columnMask[column] |= bit;
+        board->boxMask[box] |= bit;
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        isBoardGiven
+ *
+ * Parameter:       board (const struct board *) -> Spielfeld
+ * Parameter:       cell (int)                   -> Index des Feldes (0 - GRID_CELLS - 1)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn das Feld vorgegeben ist, andernfalls eine 0
+ *
+ * Beschreibung:    Liest ein Bit aus der Bitmap der vorgegebenen Felder.
+ */
+int isBoardGiven(const struct board *board, int cell) {
+    return (int) ((board->given[cell >> 6] >> (cell & 63)) & 1);
+}
+
+/**
+ * Funktion:        setBoardGiven
+ *
+ * Parameter:       board (struct board *) -> Spielfeld
+ * Parameter:       cell (int)             -> Index des Feldes (0 - GRID_CELLS - 1)
+ * Parameter:       given (int)            -> 1 = Feld ist vorgegeben, 0 = Feld kann geändert werden
+ *
+ * Beschreibung:    Setzt oder löscht ein Bit in der Bitmap der vorgegebenen Felder.
+ */
+void setBoardGiven(struct board *board, int cell, int given) {
+    if (given) {
+        board->given[cell >> 6] |= (uint64_t) 1 << (cell & 63);
+    } else {
+        board->given[cell >> 6] &= ~((uint64_t) 1 << (cell & 63));
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        getBoardCandidates
+ *
+ * Parameter:       board (const struct board *) -> Spielfeld
+ * Parameter:       cell (int)                   -> Index des Feldes (0 - GRID_CELLS - 1)
+ *
+ * Rückgabewert:    Gibt die Bitmaske der Ziffern zurück, die in Zeile, Spalte und Block des Feldes noch fehlen
+ *
+ * Beschreibung:    Ermittelt die Kandidaten eines Feldes aus den Belegungsmasken.
+ */
+digitMask getBoardCandidates(const struct board *board, int cell) {
+    return ~(board->rowMask[rowOf[cell]] | board->columnMask[columnOf[cell]] | board->boxMask[boxOf[cell]]) & ALL_DIGITS;
+}
+
+/**
+ * Funktion:        boardFromSudoku
+ *
+ * Parameter:       sudokuGrid (const struct sudoku *) -> Sudoku im bisherigen Format
+ * Parameter:       board (struct board *)             -> Enthält nach dem Funktionsaufruf das konvertierte Spielfeld
+ *
+ * Beschreibung:    Konvertiert die Struktur 'sudoku' in die kompakte Struktur 'board'.
+ */
+void boardFromSudoku(const struct sudoku *sudokuGrid, struct board *board) {
+    int i, j;
+
+    initBoard(board);
+
+    for (i = 0; i < SIZE; i++) {
+        for (j = 0; j < SIZE; j++) {
+            setBoardValue(board, i * SIZE + j, sudokuGrid->value[i][j]);
+            setBoardGiven(board, i * SIZE + j, sudokuGrid->generated[i][j] == 1);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        boardToSudoku
+ *
+ * Parameter:       board (const struct board *)   -> Kompaktes Spielfeld
+ * Parameter:       sudokuGrid (struct sudoku *)   -> Enthält nach dem Funktionsaufruf das Sudoku im bisherigen Format
+ *
+ * Beschreibung:    Konvertiert die Struktur 'board' zurück in die Struktur 'sudoku' (z.B. für die Ausgabe in views.c).
+ */
+void boardToSudoku(const struct board *board, struct sudoku *sudokuGrid) {
+    int i, j;
+
+    for (i = 0; i < SIZE; i++) {
+        for (j = 0; j < SIZE; j++) {
+            sudokuGrid->value[i][j] = board->value[i * SIZE + j];
+            sudokuGrid->generated[i][j] = isBoardGiven(board, i * SIZE + j);
+        }
+    }
+
+    return;
+}
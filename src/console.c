@@ -0,0 +1,132 @@
+#include "../header/sudoku.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <conio.h>
+#else
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+// Ältere MinGW-Header kennen den VT-Modus der Windows-Konsole noch nicht
+#if defined(_WIN32) && !defined(ENABLE_VIRTUAL_TERMINAL_PROCESSING)
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+
+/**
+ * Funktion:        initConsole
+ *
+ * Beschreibung:    Schaltet die Windows-Konsole in den VT-Modus, damit sie ANSI-Steuersequenzen auswertet.
+ *                  POSIX-Terminals können das bereits.
+ */
+void initConsole() {
+#ifdef _WIN32
+    HANDLE console;
+    DWORD mode;
+
+    console = GetStdHandle(STD_OUTPUT_HANDLE);
+
+    if (GetConsoleMode(console, &mode)) {
+        SetConsoleMode(console, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+    }
+#endif
+
+    return;
+}
+
+/**
+ * Funktion:        getConsoleRows
+ *
+ * Rückgabewert:    Gibt die Anzahl der sichtbaren Zeilen der Konsole zurück (0 = unbekannt, z.B. Ausgabe umgeleitet)
+ *
+ * Beschreibung:    Wird bei jedem Aufruf neu abgefragt, da die Größe des Fensters geändert werden kann.
+ */
+int getConsoleRows() {
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+
+    if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) {
+        return 0;
+    }
+
+    return info.srWindow.Bottom - info.srWindow.Top + 1;
+#else
+    struct winsize size;
+
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) != 0) {
+        return 0;
+    }
+
+    return size.ws_row;
+#endif
+}
+
+/**
+ * Funktion:        readKey
+ *
+ * Rückgabewert:    Gibt das Zeichen der gedrückten Taste zurück (EOF, wenn die Eingabe geschlossen ist)
+ *
+ * Beschreibung:    Wartet auf einen einzelnen Tastendruck ohne Enter und ohne Echo (unter Windows 'getch').
+ */
+int readKey() {
+#ifdef _WIN32
+    return getch();
+#else
+    struct termios saved, raw;
+    int key;
+
+    // Kein Terminal (z.B. umgeleitete Eingabe): Zeichen normal lesen
+    if (tcgetattr(STDIN_FILENO, &saved) != 0) {
+        return getchar();
+    }
+
+    raw = saved;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+    key = getchar();
+    tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+
+    return key;
+#endif
+}
+
+/**
+ * Funktion:        readLine
+ *
+ * Parameter:       inputString (char[]) -> Zeichenkette in dem die Eingabe geschrieben wird
+ *
+ * Beschreibung:    Liest eine Zeichenkette ein. Vorher wird das aufgebaute Bild ausgegeben.
+ */
+void readLine(char inputString[]) {
+    int strLen;
+
+    // Aufgebautes Bild vor der Eingabe ausgeben (stdout ist vollständig gepuffert, siehe 'initRenderer')
+    flushScreen();
+    fflush(stdin);
+
+    // Eingabe wurde geschlossen, ohne Eingabe kann keine Ansicht verlassen werden
+    if (fgets(inputString, STRLEN, stdin) == NULL) {
+        die();
+    }
+
+    strLen = strlen(inputString);
+
+    if (strLen > 0 && inputString[strLen - 1] == '\n') {
+        inputString[strLen - 1] = '\0';
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        die
+ *
+ * Beschreibung:    Terminiert das Programm bei einem unerwarteten Fehler.
+ */
+void die() {
+    clearScreen();
+    printf("Es ist ein unerwarteter Fehler aufgetreten! Bitte starten Sie das Programm neu!\n");
+    exit(0);
+    return;
+}
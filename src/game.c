@@ -0,0 +1,338 @@
+#include "../header/sudokuCore.h"
+
+/**
+ * Funktion:        countDigit
+ *
+ * Parameter:       game (struct game *) -> Spielstand
+ * Parameter:       cell (int)           -> Index des Feldes (0 - 80)
+ * Parameter:       value (int)          -> Ziffer (1 - SIZE)
+ * Parameter:       delta (int)          -> +1 = Ziffer kommt hinzu, -1 = Ziffer wird entfernt
+ *
+ * Beschreibung:    Aktualisiert die Ziffernzähler der drei Einheiten eines Feldes und die Anzahl der Konflikte.
+ */
+static void countDigit(struct game *game, int cell, int value, int delta) {
+    int units[3], i;
+    uint8_t *count;
+
+    units[0] = rowOf[cell];
+    units[1] = SIZE + columnOf[cell];
+    units[2] = 2 * SIZE + boxOf[cell];
+
+    for (i = 0; i < 3; i++) {
+        count = &game->unitCount[units[i]][value];
+
+        if (delta > 0) {
+            // Jede weitere gleiche Ziffer in der Einheit ist ein Konflikt
+            if (*count > 0) {
+                game->conflicts++;
+            }
+
+            (*count)++;
+        } else {
+            (*count)--;
+
+            if (*count > 0) {
+                game->conflicts--;
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        removeEmptyCell
+ *
+ * Parameter:       game (struct game *) -> Spielstand
+ * Parameter:       cell (int)           -> Index des bislang leeren Feldes
+ *
+ * Beschreibung:    Entfernt ein Feld in O(1) aus der Liste der leeren Felder: Der letzte Eintrag rückt an seine Stelle.
+ */
+static void removeEmptyCell(struct game *game, int cell) {
+    int position, last;
+
+    position = game->emptyPosition[cell];
+    last = game->emptyCells[--game->emptyCount];
+
+    game->emptyCells[position] = (cellIndex) last;
+    game->emptyPosition[last] = (cellIndex) position;
+
+    return;
+}
+
+/**
+ * Funktion:        addEmptyCell
+ *
+ * Parameter:       game (struct game *) -> Spielstand
+ * Parameter:       cell (int)           -> Index des soeben geleerten Feldes
+ *
+ * Beschreibung:    Hängt ein Feld in O(1) an die Liste der leeren Felder an.
+ */
+static void addEmptyCell(struct game *game, int cell) {
+    game->emptyPosition[cell] = (cellIndex) game->emptyCount;
+    game->emptyCells[game->emptyCount++] = (cellIndex) cell;
+
+    return;
+}
+
+/**
+ * Funktion:        setGameCell
+ *
+ * Parameter:       game (struct game *) -> Spielstand
+ * Parameter:       cell (int)           -> Index des Feldes (0 - 80)
+ * Parameter:       value (int)          -> Neuer Wert (0 = leeren, 1 - SIZE)
+ *
+ * Beschreibung:    Schreibt einen Wert in das Spielfeld und aktualisiert Zähler und leere Felder.
+ */
+static void setGameCell(struct game *game, int cell, int value) {
+    int oldValue;
+
+    oldValue = game->board.value[cell];
+
+    if (oldValue == value) {
+        return;
+    }
+
+    if (oldValue == 0) {
+        removeEmptyCell(game, cell);
+    } else {
+        countDigit(game, cell, oldValue, -1);
+    }
+
+    if (value == 0) {
+        addEmptyCell(game, cell);
+    } else {
+        countDigit(game, cell, value, 1);
+    }
+
+    setBoardValue(&game->board, cell, value);
+
+    return;
+}
+
+/**
+ * Funktion:        initGame
+ *
+ * Parameter:       game (struct game *)               -> Spielstand, der initialisiert wird
+ * Parameter:       sudoku (const struct savegame *)   -> Savegame-Struktur mit Spielfortschritt, Lösung und bislang benötigter Zeit
+ *
+ * Beschreibung:    Baut den Spielstand einmalig aus einem Savegame auf. Danach werden alle Zähler nur noch inkrementell geändert.
+ */
+void initGame(struct game *game, const struct savegame *sudoku) {
+    int i, j, cell;
+
+    memset(game, 0, sizeof(*game));
+    game->pastTime = sudoku->pastTime;
+
+    // Zu Beginn ist jedes Feld leer
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        addEmptyCell(game, cell);
+    }
+
+    boardFromSudoku(&sudoku->sudokuGridSolved, &game->solution);
+
+    for (i = 0; i < SIZE; i++) {
+        for (j = 0; j < SIZE; j++) {
+            cell = i * SIZE + j;
+            setGameCell(game, cell, sudoku->sudokuGrid.value[i][j]);
+            setBoardGiven(&game->board, cell, sudoku->sudokuGrid.generated[i][j] == 1);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        gameToSavegame
+ *
+ * Parameter:       game (const struct game *)  -> Spielstand
+ * Parameter:       sudoku (struct savegame *)  -> Enthält nach dem Funktionsaufruf die Savegame-Struktur (z.B. zum Speichern)
+ *
+ * Beschreibung:    Wandelt den Spielstand zurück in die Struktur 'savegame'.
+ */
+void gameToSavegame(const struct game *game, struct savegame *sudoku) {
+    boardToSudoku(&game->solution, &sudoku->sudokuGridSolved);
+    boardToSudoku(&game->board, &sudoku->sudokuGrid);
+    sudoku->pastTime = game->pastTime;
+
+    return;
+}
+
+/**
+ * Funktion:        alterGameValue
+ *
+ * Parameter:       game (struct game *)  -> Spielstand
+ * Parameter:       field (struct field)  -> Koordinaten vom Feld, in welchem der Wert geändert werden soll
+ * Parameter:       newValue (int)        -> Neuer Wert für das Feld
+ * Parameter:       *error (int)          -> Enthält nach dem Funktionsaufruf: 1 = Feld kann nicht geändert werden, 2 = Neuer Wert ist kleiner als 1, 3 = Neuer Wert ist größer als SIZE
+ *
+ * Beschreibung:    Gegenstück zu 'alterValue' für den Spielstand. Ändert ein Feld in O(1).
+ */
+void alterGameValue(struct game *game, struct field field, int newValue, int *error) {
+    int cell;
+
+    cell = field.row * SIZE + field.column;
+
+    // Vordefinierte Felder dürfen nicht geändert werden
+    if (isBoardGiven(&game->board, cell)) {
+        *error = 1;
+        return;
+    }
+
+    if (newValue < 0) {
+        *error = 2;
+        return;
+    } else if (newValue > SIZE) {
+        *error = 3;
+        return;
+    }
+
+    setGameCell(game, cell, newValue);
+    *error = 0;
+
+    return;
+}
+
+/**
+ * Funktion:        playGameMove
+ *
+ * Parameter:       game (struct game *)       -> Spielstand
+ * Parameter:       journal (struct journal *) -> Zugverlauf
+ * Parameter:       field (struct field)       -> Koordinaten vom Feld, in welchem der Wert geändert werden soll
+ * Parameter:       newValue (int)             -> Neuer Wert für das Feld
+ * Parameter:       time (uint32_t)            -> Bis zum Zug benötigte Zeit in Millisekunden
+ * Parameter:       *error (int)               -> Wie bei 'alterGameValue'
+ *
+ * Beschreibung:    Wie 'alterGameValue', nimmt einen gültigen Zug aber zusätzlich in den Verlauf auf.
+ */
+void playGameMove(struct game *game, struct journal *journal, struct field field, int newValue, uint32_t time, int *error) {
+    int cell, oldValue;
+
+    cell = field.row * SIZE + field.column;
+    oldValue = game->board.value[cell];
+
+    alterGameValue(game, field, newValue, error);
+
+    if (*error == 0) {
+        recordMove(journal, cell, oldValue, newValue, time);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        undoGameMove
+ *
+ * Parameter:       game (struct game *)       -> Spielstand
+ * Parameter:       journal (struct journal *) -> Zugverlauf
+ *
+ * Rückgabewert:    Gibt das geänderte Feld zurück oder -1, wenn es keinen Zug zum Zurücknehmen gibt
+ *
+ * Beschreibung:    Nimmt den letzten Zug in O(1) zurück, ohne ein Spielfeld zu kopieren.
+ */
+int undoGameMove(struct game *game, struct journal *journal) {
+    const struct move *move;
+
+    move = undoMove(journal);
+
+    if (move == NULL) {
+        return -1;
+    }
+
+    // Ein Verlauf aus einer Datei kann nicht zum Spielfeld passen: vorgegebene Felder bleiben unverändert
+    if (!isBoardGiven(&game->board, move->cell)) {
+        setGameCell(game, move->cell, move->oldValue);
+    }
+
+    return move->cell;
+}
+
+/**
+ * Funktion:        redoGameMove
+ *
+ * Parameter:       game (struct game *)       -> Spielstand
+ * Parameter:       journal (struct journal *) -> Zugverlauf
+ *
+ * Rückgabewert:    Gibt das geänderte Feld zurück oder -1, wenn es keinen Zug zum Wiederholen gibt
+ *
+ * Beschreibung:    Wiederholt den zuletzt zurückgenommenen Zug in O(1).
+ */
+int redoGameMove(struct game *game, struct journal *journal) {
+    const struct move *move;
+
+    move = redoMove(journal);
+
+    if (move == NULL) {
+        return -1;
+    }
+
+    if (!isBoardGiven(&game->board, move->cell)) {
+        setGameCell(game, move->cell, move->newValue);
+    }
+
+    return move->cell;
+}
+
+/**
+ * Funktion:        fillGameRandomField
+ *
+ * Parameter:       game (struct game *)     -> Spielstand
+ * Parameter:       random (struct random *) -> Zufallsgenerator
+ *
+ * Beschreibung:    Gegenstück zu 'fillRandomField' für den Spielstand. Füllt ein zufällig gewähltes leeres Feld mit dem Wert aus der Lösung.
+ *                  Das Feld wird in O(1) direkt aus der Liste der leeren Felder gezogen (vorgegebene Felder sind nie leer).
+ */
+void fillGameRandomField(struct game *game, struct random *random) {
+    int cell;
+
+    // Es kann nur ein Feld gefüllt werden, wenn es noch leere Felder gibt
+    if (game->emptyCount == 0) {
+        return;
+    }
+
+    cell = game->emptyCells[getRandomBelow(random, game->emptyCount)];
+    setGameCell(game, cell, game->solution.value[cell]);
+
+    return;
+}
+
+/**
+ * Funktion:        isGameSolved
+ *
+ * Parameter:       game (const struct game *) -> Spielstand
+ *
+ * Rückgabewert:    Gibt eine 0 für falsch zurück und eine 1 für korrekt
+ *
+ * Beschreibung:    Gegenstück zu 'checkSudoku': Prüft in O(1), ob das Sudoku vollständig und ohne Konflikte ausgefüllt ist.
+ */
+int isGameSolved(const struct game *game) {
+    return game->emptyCount == 0 && game->conflicts == 0;
+}
+
+/**
+ * Funktion:        checkGameMove
+ *
+ * Parameter:       game (const struct game *) -> Spielstand
+ * Parameter:       field (struct field)       -> Koordinaten vom Feld
+ * Parameter:       value (int)                -> Wert, der in das Feld geschrieben werden soll
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn der Wert in Zeile, Spalte oder 3x3-Block bereits an anderer Stelle steht, andernfalls eine 1
+ *
+ * Beschreibung:    Prüft in O(1), ob ein Zug einen Konflikt erzeugen würde.
+ */
+int checkGameMove(const struct game *game, struct field field, int value) {
+    int cell, own;
+
+    if (value < 1 || value > SIZE) {
+        return 1;
+    }
+
+    cell = field.row * SIZE + field.column;
+
+    // Steht der Wert bereits im Feld selbst, zählt er nicht als Konflikt
+    own = game->board.value[cell] == value;
+
+    return game->unitCount[rowOf[cell]][value] <= own
+        && game->unitCount[SIZE + columnOf[cell]][value] <= own
+        && game->unitCount[2 * SIZE + boxOf[cell]][value] <= own;
+}
@@ -0,0 +1,108 @@
+#include "../header/sudokuCore.h"
+
+/**
+ * Funktion:        hasGameSolution
+ *
+ * Parameter:       game (const struct game *) -> Spielstand
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn zum Spielstand eine vollständige Lösung gespeichert ist, andernfalls eine 0
+ */
+static int hasGameSolution(const struct game *game) {
+    int cell;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        if (game->solution.value[cell] == 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        findGameHint
+ *
+ * Parameter:       game (const struct game *) -> Spielstand
+ * Parameter:       hint (struct hint *)       -> Enthält nach dem Funktionsaufruf den Hinweis
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn ein Hinweis gefunden wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Sucht den leichtesten logischen Schritt, der ein Feld festlegt. Die Kandidaten stammen direkt aus den
+ *                  laufend gepflegten Masken des Spielfeldes, danach werden die Techniken aus rating.c in aufsteigender
+ *                  Schwierigkeit angewendet, bis ein Feld feststeht (vorher nur gestrichene Kandidaten zählen zur Technik).
+ *                  Falsch eingetragene Werte werden dabei wie leere Felder behandelt, damit kein Hinweis auf einem Fehler
+ *                  aufbaut; ein Hinweis kann daher auch ein falsch gefülltes Feld korrigieren. Nur wenn kein logischer
+ *                  Schritt möglich ist, wird das Feld mit den wenigsten Kandidaten aus der gespeicherten Lösung gefüllt.
+ *                  Ohne gespeicherte Lösung gibt es dann (oder wenn sich Ziffern widersprechen) keinen Hinweis.
+ */
+int findGameHint(const struct game *game, struct hint *hint) {
+    struct board board;
+    struct ratingGrid grid;
+    struct ratingStep step;
+    int solutionKnown, cell, steps, count, bestCount, i;
+
+    hint->cell = -1;
+    hint->value = 0;
+    hint->technique = TECHNIQUE_NONE;
+
+    if (game->emptyCount == 0 && game->conflicts == 0) {
+        return 0;
+    }
+
+    solutionKnown = hasGameSolution(game);
+    board = game->board;
+
+    if (solutionKnown) {
+        for (cell = 0; cell < GRID_CELLS; cell++) {
+            if (board.value[cell] != 0 && board.value[cell] != game->solution.value[cell]) {
+                setBoardValue(&board, cell, 0);
+            }
+        }
+    } else if (game->conflicts > 0) {
+        return 0;
+    }
+
+    initRatingGridFromBoard(&grid, &board);
+
+    for (steps = 0; steps < RATING_STEP_BUDGET && applyRatingStep(&grid, &step) != TECHNIQUE_NONE; steps++) {
+        if (step.technique > hint->technique) {
+            hint->technique = step.technique;
+        }
+
+        if (step.cell >= 0) {
+            hint->cell = step.cell;
+            hint->value = step.value;
+            return 1;
+        }
+    }
+
+    if (!solutionKnown) {
+        hint->technique = TECHNIQUE_NONE;
+        return 0;
+    }
+
+    // Kein logischer Schritt: das am stärksten eingeschränkte leere Feld aus der Lösung füllen
+    bestCount = SIZE + 1;
+
+    for (i = 0; i < game->emptyCount; i++) {
+        cell = game->emptyCells[i];
+        count = __builtin_popcount(grid.candidates[cell]);
+
+        if (count < bestCount) {
+            bestCount = count;
+            hint->cell = cell;
+        }
+    }
+
+    // Sind nur noch falsche Einträge offen, den ersten davon korrigieren
+    for (cell = 0; hint->cell < 0 && cell < GRID_CELLS; cell++) {
+        if (board.value[cell] == 0) {
+            hint->cell = cell;
+        }
+    }
+
+    hint->value = hint->cell >= 0 ? game->solution.value[hint->cell] : 0;
+    hint->technique = TECHNIQUE_NONE;
+
+    return hint->cell >= 0;
+}
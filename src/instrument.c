@@ -0,0 +1,155 @@
+#include "../header/sudokuCore.h"
+
+#ifdef SUDOKU_INSTRUMENT
+
+// Namen in der Ausgabe (Reihenfolge wie die COUNTER_* und TIMER_* Konstanten)
+static const char *counterNames[COUNTER_COUNT] = {
+    "shuffle_swaps", "grids_generated", "carve_attempts", "carve_retries", "uniqueness_checks", "solver_calls",
+    "ratings", "board_scans", "value_checks", "puzzles_parsed", "file_opens", "file_reads", "file_writes"
+};
+
+static const char *timerNames[TIMER_COUNT] = {
+    "generate", "carve", "rate", "validate", "parse", "savegame_io"
+};
+
+// Messwerte des eigenen Threads (NULL bis zum ersten Messpunkt)
+_Thread_local struct instrumentSlot *instrumentSlot;
+
+// Liste der Messwerte aller Threads, die je einen Messpunkt erreicht haben (wird nur verlängert)
+static _Atomic(struct instrumentSlot *) instrumentSlots;
+
+/**
+ * Funktion:        writeInstrumentReportAtExit
+ *
+ * Beschreibung:    Gibt die Messwerte bei Programmende in die Datei aus INSTRUMENT_FILE_VARIABLE oder auf stderr aus.
+ */
+static void writeInstrumentReportAtExit() {
+    const char *path;
+    FILE *fileHandle;
+
+    path = getenv(INSTRUMENT_FILE_VARIABLE);
+    fileHandle = path != NULL ? fopen(path, "w") : NULL;
+
+    writeInstrumentReport(fileHandle != NULL ? fileHandle : stderr);
+
+    if (fileHandle != NULL) {
+        fclose(fileHandle);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        registerInstrumentSlot
+ *
+ * Rückgabewert:    Gibt die Messwerte des eigenen Threads zurück
+ *
+ * Beschreibung:    Legt beim ersten Messpunkt eines Threads seine Messwerte an und hängt sie ohne Sperre an die Liste.
+ *                  Der erste Thread meldet die Ausgabe bei Programmende an. Ist kein Speicher frei, zählt der Thread in
+ *                  einen gemeinsamen Ersatzbereich (ungenau, aber ohne Absturz).
+ */
+struct instrumentSlot *registerInstrumentSlot() {
+    static struct instrumentSlot fallback;
+    struct instrumentSlot *slot, *head;
+
+    slot = calloc(1, sizeof(*slot));
+
+    if (slot == NULL) {
+        instrumentSlot = &fallback;
+        return instrumentSlot;
+    }
+
+    head = atomic_load(&instrumentSlots);
+
+    do {
+        slot->next = head;
+    } while (!atomic_compare_exchange_weak(&instrumentSlots, &head, slot));
+
+    if (head == NULL) {
+        atexit(writeInstrumentReportAtExit);
+    }
+
+    instrumentSlot = slot;
+
+    return instrumentSlot;
+}
+
+/**
+ * Funktion:        addInstrumentTime
+ *
+ * Parameter:       timer (int)            -> TIMER_* Konstante
+ * Parameter:       nanoseconds (uint64_t) -> Dauer des Abschnitts
+ *
+ * Beschreibung:    Trägt eine Zeitmessung des eigenen Threads ein.
+ */
+void addInstrumentTime(int timer, uint64_t nanoseconds) {
+    struct instrumentTimer *entry;
+
+    entry = &(instrumentSlot != NULL ? instrumentSlot : registerInstrumentSlot())->timer[timer];
+
+    atomic_store_explicit(&entry->calls, atomic_load_explicit(&entry->calls, memory_order_relaxed) + 1, memory_order_relaxed);
+    atomic_store_explicit(&entry->total, atomic_load_explicit(&entry->total, memory_order_relaxed) + nanoseconds,
+                          memory_order_relaxed);
+
+    if (nanoseconds > atomic_load_explicit(&entry->maximum, memory_order_relaxed)) {
+        atomic_store_explicit(&entry->maximum, nanoseconds, memory_order_relaxed);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        writeInstrumentReport
+ *
+ * Parameter:       fileHandle (FILE *) -> Ausgabe
+ *
+ * Beschreibung:    Gibt die Summe der Messwerte aller Threads aus, eine Angabe je Zeile im Format "<schlüssel> <wert>":
+ *
+ *                      counter.<name> <anzahl>
+ *                      timer.<name>.calls <anzahl>
+ *                      timer.<name>.total_ns <nanosekunden>
+ *                      timer.<name>.max_ns <nanosekunden>
+ *
+ *                  Kann jederzeit aufgerufen werden, laufende Threads zählen dabei weiter.
+ */
+void writeInstrumentReport(FILE *fileHandle) {
+    uint64_t counters[COUNTER_COUNT] = { 0 }, calls[TIMER_COUNT] = { 0 }, total[TIMER_COUNT] = { 0 };
+    uint64_t maximum[TIMER_COUNT] = { 0 }, value;
+    struct instrumentSlot *slot;
+    int i, threads;
+
+    threads = 0;
+
+    for (slot = atomic_load(&instrumentSlots); slot != NULL; slot = slot->next) {
+        threads++;
+
+        for (i = 0; i < COUNTER_COUNT; i++) {
+            counters[i] += atomic_load_explicit(&slot->counter[i], memory_order_relaxed);
+        }
+
+        for (i = 0; i < TIMER_COUNT; i++) {
+            calls[i] += atomic_load_explicit(&slot->timer[i].calls, memory_order_relaxed);
+            total[i] += atomic_load_explicit(&slot->timer[i].total, memory_order_relaxed);
+            value = atomic_load_explicit(&slot->timer[i].maximum, memory_order_relaxed);
+            maximum[i] = value > maximum[i] ? value : maximum[i];
+        }
+    }
+
+    fprintf(fileHandle, "threads %d\n", threads);
+
+    for (i = 0; i < COUNTER_COUNT; i++) {
+        fprintf(fileHandle, "counter.%s %llu\n", counterNames[i], (unsigned long long) counters[i]);
+    }
+
+    for (i = 0; i < TIMER_COUNT; i++) {
+        fprintf(fileHandle, "timer.%s.calls %llu\n", timerNames[i], (unsigned long long) calls[i]);
+        fprintf(fileHandle, "timer.%s.total_ns %llu\n", timerNames[i], (unsigned long long) total[i]);
+        fprintf(fileHandle, "timer.%s.max_ns %llu\n", timerNames[i], (unsigned long long) maximum[i]);
+    }
+
+    fflush(fileHandle);
+
+    return;
+}
+
+#endif // SUDOKU_INSTRUMENT
@@ -0,0 +1,160 @@
+#include "../header/sudokuCore.h"
+
+/**
+ * Funktion:        initJournal
+ *
+ * Parameter:       journal (struct journal *) -> Verlauf, der initialisiert wird
+ *
+ * Beschreibung:    Legt einen leeren Verlauf an. Speicher wird erst mit dem ersten Zug angefordert.
+ */
+void initJournal(struct journal *journal) {
+    memset(journal, 0, sizeof(*journal));
+
+    return;
+}
+
+/**
+ * Funktion:        freeJournal
+ *
+ * Parameter:       journal (struct journal *) -> Verlauf
+ *
+ * Beschreibung:    Gibt den Speicher frei. Der Verlauf ist danach leer und kann weiter verwendet werden.
+ */
+void freeJournal(struct journal *journal) {
+    free(journal->moves);
+    initJournal(journal);
+
+    return;
+}
+
+/**
+ * Funktion:        growJournal
+ *
+ * Parameter:       journal (struct journal *) -> Verlauf, dessen Ringpuffer voll ist
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Puffer vergrößert wurde, andernfalls eine 0 (Obergrenze erreicht oder kein Speicher)
+ *
+ * Beschreibung:    Verdoppelt die Kapazität. Der Ring wird dabei aufgerollt, der älteste Zug steht danach am Anfang.
+ */
+static int growJournal(struct journal *journal) {
+    struct move *moves;
+    int capacity, i;
+
+    if (journal->capacity >= JOURNAL_MAX_MOVES) {
+        return 0;
+    }
+
+    capacity = journal->capacity > 0 ? 2 * journal->capacity : JOURNAL_INITIAL_CAPACITY;
+    moves = malloc(sizeof(*moves) * capacity);
+
+    if (moves == NULL) {
+        return 0;
+    }
+
+    for (i = 0; i < journal->count; i++) {
+        moves[i] = *getJournalMove(journal, i);
+    }
+
+    free(journal->moves);
+    journal->moves = moves;
+    journal->capacity = capacity;
+    journal->first = 0;
+
+    return 1;
+}
+
+/**
+ * Funktion:        recordMove
+ *
+ * Parameter:       journal (struct journal *) -> Verlauf
+ * Parameter:       cell (int)                 -> Index des geänderten Feldes
+ * Parameter:       oldValue (int)             -> Wert vor dem Zug
+ * Parameter:       newValue (int)             -> Wert nach dem Zug
+ * Parameter:       time (uint32_t)            -> Bis zum Zug benötigte Zeit in Millisekunden
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Zug aufgenommen wurde, andernfalls eine 0 (kein Speicher, der Verlauf bleibt gültig)
+ *
+ * Beschreibung:    Hängt einen Zug in O(1) an (amortisiert, der Puffer wächst bis JOURNAL_MAX_MOVES). Rückgängig gemachte Züge
+ *                  werden dabei verworfen. Bei voller Obergrenze fällt der älteste Zug heraus. Züge ohne Änderung werden
+ *                  nicht aufgenommen.
+ */
+int recordMove(struct journal *journal, int cell, int oldValue, int newValue, uint32_t time) {
+    struct move *move;
+
+    if (oldValue == newValue) {
+        return 1;
+    }
+
+    journal->count = journal->position;
+
+    if (journal->count == journal->capacity && !growJournal(journal)) {
+        if (journal->capacity == 0) {
+            return 0;
+        }
+
+        journal->first = (journal->first + 1) & (journal->capacity - 1);
+        journal->count--;
+        journal->position--;
+    }
+
+    move = &journal->moves[(journal->first + journal->count) & (journal->capacity - 1)];
+    move->cell = (cellIndex) cell;
+    move->oldValue = (uint8_t) oldValue;
+    move->newValue = (uint8_t) newValue;
+    move->time = time;
+
+    journal->count++;
+    journal->position++;
+
+    return 1;
+}
+
+/**
+ * Funktion:        getJournalMove
+ *
+ * Parameter:       journal (const struct journal *) -> Verlauf
+ * Parameter:       index (int)                      -> Nummer des Zugs (0 = ältester, muss kleiner als 'count' sein)
+ *
+ * Rückgabewert:    Gibt den Zug zurück
+ */
+const struct move *getJournalMove(const struct journal *journal, int index) {
+    return &journal->moves[(journal->first + index) & (journal->capacity - 1)];
+}
+
+/**
+ * Funktion:        undoMove
+ *
+ * Parameter:       journal (struct journal *) -> Verlauf
+ *
+ * Rückgabewert:    Gibt den zuletzt angewendeten Zug zurück oder NULL, wenn es keinen gibt
+ *
+ * Beschreibung:    Nimmt einen Zug in O(1) zurück. Der Aufrufer setzt das Feld danach auf 'oldValue'.
+ */
+const struct move *undoMove(struct journal *journal) {
+    if (journal->position == 0) {
+        return NULL;
+    }
+
+    journal->position--;
+
+    return getJournalMove(journal, journal->position);
+}
+
+/**
+ * Funktion:        redoMove
+ *
+ * Parameter:       journal (struct journal *) -> Verlauf
+ *
+ * Rückgabewert:    Gibt den zuletzt rückgängig gemachten Zug zurück oder NULL, wenn es keinen gibt
+ *
+ * Beschreibung:    Wiederholt einen Zug in O(1). Der Aufrufer setzt das Feld danach auf 'newValue'.
+ */
+const struct move *redoMove(struct journal *journal) {
+    if (journal->position == journal->count) {
+        return NULL;
+    }
+
+    journal->position++;
+
+    return getJournalMove(journal, journal->position - 1);
+}
@@ -0,0 +1,422 @@
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../header/sudoku.h"
+
+// Kennung und Version der Vorratsdatei
+#define POOL_MAGIC "SKPL"
+#define POOL_VERSION 1
+
+// Kopf der Vorratsdatei: Kennung, Version, Anzahl je Schwierigkeitsgrad
+#define POOL_HEADER_SIZE 8
+
+// Fertiges Sudoku im Vorrat (Rätsel und Lösung, je ein Byte pro Feld)
+struct pooledPuzzle {
+    uint8_t puzzle[GRID_CELLS];
+    uint8_t solution[GRID_CELLS];
+};
+
+// Ringpuffer mit genau einem Erzeuger (Hintergrund-Thread) und einem Verbraucher (Oberfläche), ohne Sperren
+struct puzzleRing {
+    struct pooledPuzzle slots[POOL_CAPACITY];
+    atomic_uint head; // Nächster zu entnehmender Platz, schreibt nur der Verbraucher
+    atomic_uint tail; // Nächster zu füllender Platz, schreibt nur der Erzeuger
+};
+
+// Vorrat für die drei Schwierigkeitsgrade
+struct puzzlePool {
+    struct puzzleRing rings[DIFFICULT];
+    struct random random;   // Zufallsgenerator des Hintergrund-Threads
+    pthread_t worker;
+    pthread_mutex_t lock;   // Nur zum Schlafenlegen und Wecken des Hintergrund-Threads
+    pthread_cond_t wake;
+    atomic_int running;
+    int started;
+};
+
+static struct puzzlePool pool;
+
+/**
+ * Funktion:        getRingCount
+ *
+ * Parameter:       ring (struct puzzleRing *) -> Ringpuffer
+ *
+ * Rückgabewert:    Gibt die Anzahl der Sudokus im Ringpuffer zurück
+ */
+static unsigned int getRingCount(struct puzzleRing *ring) {
+    return atomic_load_explicit(&ring->tail, memory_order_acquire) - atomic_load_explicit(&ring->head, memory_order_acquire);
+}
+
+/**
+ * Funktion:        pushPuzzle
+ *
+ * Parameter:       ring (struct puzzleRing *)            -> Ringpuffer
+ * Parameter:       puzzle (const struct pooledPuzzle *)  -> Sudoku, welches abgelegt wird
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn der Ringpuffer voll ist, andernfalls eine 1
+ *
+ * Beschreibung:    Darf nur vom Erzeuger aufgerufen werden. Der Platz wird erst gefüllt und dann mit 'tail' freigegeben.
+ */
+static int pushPuzzle(struct puzzleRing *ring, const struct pooledPuzzle *puzzle) {
+    unsigned int tail;
+
+    tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    if (tail - atomic_load_explicit(&ring->head, memory_order_acquire) >= POOL_CAPACITY) {
+        return 0;
+    }
+
+    ring->slots[tail & (POOL_CAPACITY - 1)] = *puzzle;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * Funktion:        popPuzzle
+ *
+ * Parameter:       ring (struct puzzleRing *)     -> Ringpuffer
+ * Parameter:       puzzle (struct pooledPuzzle *) -> Enthält nach dem Funktionsaufruf das entnommene Sudoku
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn der Ringpuffer leer ist, andernfalls eine 1
+ *
+ * Beschreibung:    Darf nur vom Verbraucher aufgerufen werden. Der Platz wird erst kopiert und dann mit 'head' freigegeben.
+ */
+static int popPuzzle(struct puzzleRing *ring, struct pooledPuzzle *puzzle) {
+    unsigned int head;
+
+    head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    if (head == atomic_load_explicit(&ring->tail, memory_order_acquire)) {
+        return 0;
+    }
+
+    *puzzle = ring->slots[head & (POOL_CAPACITY - 1)];
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * Funktion:        needsRefill
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn ein Schwierigkeitsgrad unter POOL_LOW_WATER gefallen ist, andernfalls eine 0
+ */
+static int needsRefill() {
+    int difficulty;
+
+    for (difficulty = EASY; difficulty <= DIFFICULT; difficulty++) {
+        if (getRingCount(&pool.rings[difficulty - 1]) < POOL_LOW_WATER) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        runRefill
+ *
+ * Parameter:       argument (void *) -> Nicht verwendet
+ *
+ * Rückgabewert:    Gibt NULL zurück
+ *
+ * Beschreibung:    Hintergrund-Thread: Fällt ein Schwierigkeitsgrad unter POOL_LOW_WATER, wird er wieder bis POOL_CAPACITY
+ *                  gefüllt. Je Durchlauf ein Sudoku pro Schwierigkeitsgrad, damit ein leerer Grad nicht auf die anderen wartet.
+ *                  Ist nichts zu tun, schläft der Thread, bis 'takePooledPuzzle' oder 'stopPuzzlePool' ihn weckt.
+ */
+static void *runRefill(void *argument) {
+    struct pooledPuzzle puzzle;
+    struct sudoku solution, playable;
+    int refilling[DIFFICULT] = {0}, difficulty, busy, i;
+    unsigned int count;
+
+    (void) argument;
+
+    while (atomic_load(&pool.running)) {
+        busy = 0;
+
+        for (difficulty = EASY; difficulty <= DIFFICULT && atomic_load(&pool.running); difficulty++) {
+            count = getRingCount(&pool.rings[difficulty - 1]);
+
+            if (count < POOL_LOW_WATER) {
+                refilling[difficulty - 1] = 1;
+            }
+
+            if (!refilling[difficulty - 1]) {
+                continue;
+            }
+
+            if (count >= POOL_CAPACITY) {
+                refilling[difficulty - 1] = 0;
+                continue;
+            }
+
+            solution = generateFullSudoku(&pool.random, DEFAULT_GENERATOR);
+            playable = makeSodukoPlayableRated(solution, difficulty, &pool.random);
+
+            for (i = 0; i < GRID_CELLS; i++) {
+                puzzle.puzzle[i] = (uint8_t) playable.value[i / SIZE][i % SIZE];
+                puzzle.solution[i] = (uint8_t) solution.value[i / SIZE][i % SIZE];
+            }
+
+            pushPuzzle(&pool.rings[difficulty - 1], &puzzle);
+            busy = 1;
+        }
+
+        if (!busy) {
+            pthread_mutex_lock(&pool.lock);
+
+            while (atomic_load(&pool.running) && !needsRefill()) {
+                pthread_cond_wait(&pool.wake, &pool.lock);
+            }
+
+            pthread_mutex_unlock(&pool.lock);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Funktion:        isPooledPuzzleValid
+ *
+ * Parameter:       puzzle (const struct pooledPuzzle *) -> Geladenes Sudoku
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Lösung gültig ist und das Rätsel zur Lösung passt, andernfalls eine 0
+ */
+static int isPooledPuzzleValid(const struct pooledPuzzle *puzzle) {
+    int i;
+
+    if (!checkGrid(puzzle->solution)) {
+        return 0;
+    }
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        if (puzzle->puzzle[i] != 0 && puzzle->puzzle[i] != puzzle->solution[i]) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        loadPool
+ *
+ * Beschreibung:    Lädt den beim letzten Beenden gespeicherten Vorrat. Eine fehlende oder beschädigte Datei wird ignoriert,
+ *                  der Vorrat wird dann vom Hintergrund-Thread neu gefüllt.
+ */
+static void loadPool() {
+    uint8_t buffer[POOL_HEADER_SIZE + DIFFICULT * POOL_CAPACITY * sizeof(struct pooledPuzzle) + 4];
+    struct pooledPuzzle puzzle;
+    FILE *fileHandle;
+    size_t length, expected, offset;
+    int difficulty, i;
+
+    fileHandle = fopen(POOL_FILE, "rb");
+
+    if (fileHandle == NULL) {
+        return;
+    }
+
+    length = fread(buffer, 1, sizeof(buffer), fileHandle);
+    fclose(fileHandle);
+
+    if (length < POOL_HEADER_SIZE + 4 || memcmp(buffer, POOL_MAGIC, 4) != 0 || buffer[4] != POOL_VERSION) {
+        return;
+    }
+
+    expected = POOL_HEADER_SIZE + 4;
+
+    for (difficulty = EASY; difficulty <= DIFFICULT; difficulty++) {
+        if (buffer[4 + difficulty] > POOL_CAPACITY) {
+            return;
+        }
+
+        expected += buffer[4 + difficulty] * sizeof(struct pooledPuzzle);
+    }
+
+    if (length != expected || readUint32(buffer + length - 4) != getCrc32(buffer, length - 4)) {
+        return;
+    }
+
+    offset = POOL_HEADER_SIZE;
+
+    for (difficulty = EASY; difficulty <= DIFFICULT; difficulty++) {
+        for (i = 0; i < buffer[4 + difficulty]; i++) {
+            memcpy(puzzle.puzzle, buffer + offset, GRID_CELLS);
+            memcpy(puzzle.solution, buffer + offset + GRID_CELLS, GRID_CELLS);
+            offset += sizeof(struct pooledPuzzle);
+
+            if (isPooledPuzzleValid(&puzzle)) {
+                pushPuzzle(&pool.rings[difficulty - 1], &puzzle);
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        savePool
+ *
+ * Beschreibung:    Speichert alle noch nicht vergebenen Sudokus, damit der nächste Start sofort Sudokus zur Verfügung hat.
+ *                  Darf erst aufgerufen werden, wenn der Hintergrund-Thread beendet ist.
+ */
+static void savePool() {
+    uint8_t buffer[POOL_HEADER_SIZE + DIFFICULT * POOL_CAPACITY * sizeof(struct pooledPuzzle) + 4];
+    struct pooledPuzzle puzzle;
+    FILE *fileHandle;
+    size_t length;
+    int difficulty;
+
+    memcpy(buffer, POOL_MAGIC, 4);
+    buffer[4] = POOL_VERSION;
+    length = POOL_HEADER_SIZE;
+
+    for (difficulty = EASY; difficulty <= DIFFICULT; difficulty++) {
+        buffer[4 + difficulty] = 0;
+
+        while (popPuzzle(&pool.rings[difficulty - 1], &puzzle)) {
+            memcpy(buffer + length, puzzle.puzzle, GRID_CELLS);
+            memcpy(buffer + length + GRID_CELLS, puzzle.solution, GRID_CELLS);
+            length += sizeof(struct pooledPuzzle);
+            buffer[4 + difficulty]++;
+        }
+    }
+
+    writeUint32(buffer + length, getCrc32(buffer, length));
+    length += 4;
+
+    fileHandle = fopen(POOL_FILE, "wb");
+
+    if (fileHandle == NULL) {
+        return;
+    }
+
+    fwrite(buffer, 1, length, fileHandle);
+    fclose(fileHandle);
+
+    return;
+}
+
+/**
+ * Funktion:        startPuzzlePool
+ *
+ * Parameter:       seed (uint64_t) -> Startwert für den Zufallsgenerator des Hintergrund-Threads
+ *
+ * Beschreibung:    Lädt den gespeicherten Vorrat und startet den Hintergrund-Thread, der ihn gefüllt hält.
+ *                  Kann der Thread nicht gestartet werden, werden nur die geladenen Sudokus vergeben.
+ */
+void startPuzzlePool(uint64_t seed) {
+    int difficulty;
+
+    for (difficulty = EASY; difficulty <= DIFFICULT; difficulty++) {
+        atomic_init(&pool.rings[difficulty - 1].head, 0);
+        atomic_init(&pool.rings[difficulty - 1].tail, 0);
+    }
+
+    seedRandom(&pool.random, seed);
+    loadPool();
+
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.wake, NULL);
+    atomic_init(&pool.running, 1);
+    pool.started = 1;
+
+    if (pthread_create(&pool.worker, NULL, runRefill, NULL) != 0) {
+        atomic_store(&pool.running, 0);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        takePooledPuzzle
+ *
+ * Parameter:       difficulty (int)            -> Schwierigkeitsgrad (EASY, MEDIUM oder DIFFICULT)
+ * Parameter:       sudoku (struct savegame *)  -> Enthält nach dem Funktionsaufruf das neue Spiel
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn kein Sudoku vorrätig ist (der Aufrufer generiert dann selbst), andernfalls eine 1
+ *
+ * Beschreibung:    Entnimmt ohne Sperre ein fertiges Sudoku. Nur wenn der Füllstand danach unter POOL_LOW_WATER liegt,
+ *                  wird der Hintergrund-Thread geweckt.
+ */
+int takePooledPuzzle(int difficulty, struct savegame *sudoku) {
+    struct pooledPuzzle puzzle;
+    int taken, i;
+
+    if (!pool.started || difficulty < EASY || difficulty > DIFFICULT) {
+        return 0;
+    }
+
+    taken = popPuzzle(&pool.rings[difficulty - 1], &puzzle);
+
+    if (getRingCount(&pool.rings[difficulty - 1]) < POOL_LOW_WATER && atomic_load(&pool.running)) {
+        pthread_mutex_lock(&pool.lock);
+        pthread_cond_signal(&pool.wake);
+        pthread_mutex_unlock(&pool.lock);
+    }
+
+    if (!taken) {
+        return 0;
+    }
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        sudoku->sudokuGridSolved.value[i / SIZE][i % SIZE] = puzzle.solution[i];
+        sudoku->sudokuGridSolved.generated[i / SIZE][i % SIZE] = 1;
+        sudoku->sudokuGrid.value[i / SIZE][i % SIZE] = puzzle.puzzle[i];
+        sudoku->sudokuGrid.generated[i / SIZE][i % SIZE] = puzzle.puzzle[i] != 0;
+    }
+
+    sudoku->pastTime = 0.0;
+    sudoku->difficulty = difficulty;
+
+    return 1;
+}
+
+/**
+ * Funktion:        getPooledPuzzleCount
+ *
+ * Parameter:       difficulty (int) -> Schwierigkeitsgrad (EASY, MEDIUM oder DIFFICULT)
+ *
+ * Rückgabewert:    Gibt die Anzahl vorrätiger Sudokus des Schwierigkeitsgrades zurück
+ */
+int getPooledPuzzleCount(int difficulty) {
+    if (!pool.started || difficulty < EASY || difficulty > DIFFICULT) {
+        return 0;
+    }
+
+    return (int) getRingCount(&pool.rings[difficulty - 1]);
+}
+
+/**
+ * Funktion:        stopPuzzlePool
+ *
+ * Beschreibung:    Beendet den Hintergrund-Thread (ein gerade entstehendes Sudoku wird noch fertig generiert)
+ *                  und speichert den Vorrat für den nächsten Start.
+ */
+void stopPuzzlePool() {
+    int wasRunning;
+
+    if (!pool.started) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    wasRunning = atomic_exchange(&pool.running, 0);
+    pthread_cond_broadcast(&pool.wake);
+    pthread_mutex_unlock(&pool.lock);
+
+    if (wasRunning) {
+        pthread_join(pool.worker, NULL);
+    }
+
+    pthread_cond_destroy(&pool.wake);
+    pthread_mutex_destroy(&pool.lock);
+    savePool();
+    pool.started = 0;
+
+    return;
+}
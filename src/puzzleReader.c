@@ -0,0 +1,451 @@
+#include "../header/sudokuCore.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * Funktion:        openPuzzleReader
+ *
+ * Parameter:       reader (struct puzzleReader *) -> Enthält nach dem Funktionsaufruf die geöffnete Datei
+ * Parameter:       path (const char *)            -> Pfad zur Datei
+ *
+ * Rückgabewert:    Gibt PARSER_VALID zurück, wenn die Datei geöffnet wurde, andernfalls PARSER_FILE_INACCESSIBLE
+ *
+ * Beschreibung:    Blendet eine Datei schreibgeschützt in den Speicher ein. Die Rätsel werden danach ohne weitere
+ *                  Dateizugriffe direkt aus dem Speicher gelesen.
+ */
+int openPuzzleReader(struct puzzleReader *reader, const char *path) {
+#ifdef _WIN32
+    LARGE_INTEGER size;
+
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+    memset(reader, 0, sizeof(*reader));
+    reader->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+    if (reader->file == INVALID_HANDLE_VALUE) {
+        return PARSER_FILE_INACCESSIBLE;
+    }
+
+    if (!GetFileSizeEx(reader->file, &size)) {
+        CloseHandle(reader->file);
+        return PARSER_FILE_INACCESSIBLE;
+    }
+
+    reader->size = (size_t) size.QuadPart;
+
+    // Leere Dateien können nicht eingeblendet werden
+    if (reader->size == 0) {
+        return PARSER_VALID;
+    }
+
+    reader->mapping = CreateFileMappingA(reader->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    reader->data = reader->mapping == NULL ? NULL : MapViewOfFile(reader->mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (reader->data == NULL) {
+        if (reader->mapping != NULL) {
+            CloseHandle(reader->mapping);
+        }
+
+        CloseHandle(reader->file);
+        return PARSER_FILE_INACCESSIBLE;
+    }
+#else
+    struct stat status;
+    void *data;
+    int fileDescriptor;
+
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+    memset(reader, 0, sizeof(*reader));
+    fileDescriptor = open(path, O_RDONLY);
+
+    if (fileDescriptor < 0) {
+        return PARSER_FILE_INACCESSIBLE;
+    }
+
+    if (fstat(fileDescriptor, &status) != 0 || !S_ISREG(status.st_mode)) {
+        close(fileDescriptor);
+        return PARSER_FILE_INACCESSIBLE;
+    }
+
+    reader->size = (size_t) status.st_size;
+
+    // Leere Dateien können nicht eingeblendet werden
+    if (reader->size > 0) {
+        data = mmap(NULL, reader->size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        if (data == MAP_FAILED) {
+            close(fileDescriptor);
+            return PARSER_FILE_INACCESSIBLE;
+        }
+
+        madvise(data, reader->size, MADV_SEQUENTIAL);
+        reader->data = data;
+    }
+
+    // Die Einblendung bleibt auch nach dem Schließen der Datei gültig
+    close(fileDescriptor);
+#endif
+
+    return PARSER_VALID;
+}
+
+/**
+ * Funktion:        closePuzzleReader
+ *
+ * Parameter:       reader (struct puzzleReader *) -> Geöffnete Datei
+ *
+ * Beschreibung:    Gibt die Einblendung und die Datei wieder frei.
+ */
+void closePuzzleReader(struct puzzleReader *reader) {
+#ifdef _WIN32
+    if (reader->data != NULL) {
+        UnmapViewOfFile(reader->data);
+        CloseHandle(reader->mapping);
+    }
+
+    CloseHandle(reader->file);
+#else
+    if (reader->data != NULL) {
+        munmap((void *) reader->data, reader->size);
+    }
+#endif
+
+    memset(reader, 0, sizeof(*reader));
+
+    return;
+}
+
+/**
+ * Funktion:        cellValue
+ *
+ * Parameter:       character (char) -> Zeichen aus der Datei
+ *
+ * Rückgabewert:    Gibt den Wert des Feldes zurück (0 = leer, 1 - SIZE) oder -1 bei einem ungültigen Zeichen
+ *
+ * Beschreibung:    '0' und '.' stehen für ein leeres Feld, ab 10 stehen Buchstaben für die Ziffern (siehe 'charToValue').
+ */
+static int cellValue(char character) {
+    return charToValue((unsigned char) character);
+}
+
+/**
+ * Funktion:        isLineEnd
+ *
+ * Parameter:       position (const char *) -> Aktuelle Position
+ * Parameter:       end (const char *)      -> Ende der Datei
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Zeile an dieser Position endet, andernfalls eine 0
+ */
+static int isLineEnd(const char *position, const char *end) {
+    return position >= end || *position == '\n' || *position == '\r';
+}
+
+/**
+ * Funktion:        skipBlanks
+ *
+ * Parameter:       position (const char *) -> Aktuelle Position
+ * Parameter:       end (const char *)      -> Ende der Datei
+ *
+ * Rückgabewert:    Gibt die Position nach allen Leerzeichen und Tabulatoren zurück
+ */
+static const char *skipBlanks(const char *position, const char *end) {
+    while (position < end && (*position == ' ' || *position == '\t')) {
+        position++;
+    }
+
+    return position;
+}
+
+/**
+ * Funktion:        skipLine
+ *
+ * Parameter:       position (const char *) -> Aktuelle Position
+ * Parameter:       end (const char *)      -> Ende der Datei
+ *
+ * Rückgabewert:    Gibt die Position am Anfang der nächsten Zeile zurück (oder das Ende der Datei)
+ */
+static const char *skipLine(const char *position, const char *end) {
+    const char *next;
+
+    next = memchr(position, '\n', (size_t) (end - position));
+
+    return next == NULL ? end : next + 1;
+}
+
+/**
+ * Funktion:        isCellLine
+ *
+ * Parameter:       position (const char *) -> Anfang der Zeile
+ * Parameter:       end (const char *)      -> Ende der Datei
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Zeile mit GRID_CELLS Feldern ohne Trennzeichen beginnt, andernfalls eine 0
+ */
+static int isCellLine(const char *position, const char *end) {
+    int i;
+
+    if (end - position < GRID_CELLS) {
+        return 0;
+    }
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        if (cellValue(position[i]) < 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        scanCellLine
+ *
+ * Parameter:       position (const char *)  -> Anfang der Zeile
+ * Parameter:       end (const char *)       -> Ende der Datei
+ * Parameter:       grid (uint8_t[GRID_CELLS])     -> Enthält nach dem Funktionsaufruf das Rätsel
+ * Parameter:       solution (uint8_t[GRID_CELLS]) -> Enthält nach dem Funktionsaufruf die Lösung (falls vorhanden)
+ * Parameter:       hasSolution (int *)      -> Enthält nach dem Funktionsaufruf eine 1, wenn eine Lösung angegeben ist
+ *
+ * Rückgabewert:    Gibt die Position nach dem gelesenen Rätsel zurück oder NULL bei einem Fehler
+ *
+ * Beschreibung:    Liest eine Zeile im Format "<GRID_CELLS Felder>[ <GRID_CELLS Ziffern Lösung>]". Als Trenner sind auch ',' und ';' erlaubt.
+ */
+static const char *scanCellLine(const char *position, const char *end, uint8_t grid[GRID_CELLS],
+                                uint8_t solution[GRID_CELLS], int *hasSolution) {
+    int i;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        grid[i] = (uint8_t) cellValue(position[i]);
+    }
+
+    position += GRID_CELLS;
+
+    while (position < end && (*position == ' ' || *position == '\t' || *position == ',' || *position == ';')) {
+        position++;
+    }
+
+    *hasSolution = 0;
+
+    if (isLineEnd(position, end)) {
+        return position;
+    }
+
+    if (end - position < GRID_CELLS) {
+        return NULL;
+    }
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        if (cellValue(position[i]) < 1) {
+            return NULL;
+        }
+
+        solution[i] = (uint8_t) cellValue(position[i]);
+    }
+
+    position = skipBlanks(position + GRID_CELLS, end);
+    *hasSolution = 1;
+
+    return isLineEnd(position, end) ? position : NULL;
+}
+
+/**
+ * Funktion:        countFields
+ *
+ * Parameter:       position (const char *) -> Anfang der Zeile
+ * Parameter:       end (const char *)      -> Ende der Datei
+ *
+ * Rückgabewert:    Gibt die Anzahl der kommagetrennten Werte der Zeile zurück (ein Komma am Zeilenende zählt nicht)
+ */
+static int countFields(const char *position, const char *end) {
+    int fields;
+
+    position = skipBlanks(position, end);
+    fields = isLineEnd(position, end) ? 0 : 1;
+
+    for (; !isLineEnd(position, end); position++) {
+        if (*position == ',' && !isLineEnd(skipBlanks(position + 1, end), end)) {
+            fields++;
+        }
+    }
+
+    return fields;
+}
+
+/**
+ * Funktion:        skipCommaGrid
+ *
+ * Parameter:       reader (struct puzzleReader *) -> Datei (die Zeilennummer wird mitgezählt)
+ * Parameter:       line (const char *)            -> Anfang der fehlerhaften Zeile
+ * Parameter:       end (const char *)             -> Ende der Datei
+ * Parameter:       fields (int)                   -> Werte je Zeile des Rätsels
+ * Parameter:       lines (int)                    -> Bereits gelesene Zeilen des Rätsels (einschließlich 'line')
+ * Parameter:       stop (const char **)           -> Enthält nach dem Funktionsaufruf den Anfang der letzten übersprungenen Zeile
+ *
+ * Beschreibung:    Überspringt nach einem Fehler die restlichen Zeilen des Rätsels, damit sie nicht als eigene Rätsel gelesen
+ *                  werden. Eine leere Zeile, ein Kommentar oder eine Zeile mit GRID_CELLS Feldern beendet das Rätsel vorzeitig.
+ */
+static void skipCommaGrid(struct puzzleReader *reader, const char *line, const char *end, int fields, int lines,
+                          const char **stop) {
+    const char *next;
+
+    while (fields > 0 && GRID_CELLS % fields == 0 && lines < GRID_CELLS / fields) {
+        next = skipLine(line, end);
+
+        if (next >= end || isLineEnd(skipBlanks(next, end), end) || *skipBlanks(next, end) == '#'
+            || isCellLine(skipBlanks(next, end), end)) {
+            break;
+        }
+
+        line = next;
+        lines++;
+        reader->line++;
+    }
+
+    *stop = line;
+
+    return;
+}
+
+/**
+ * Funktion:        scanCommaGrid
+ *
+ * Parameter:       reader (struct puzzleReader *) -> Datei (die Zeilennummer wird mitgezählt)
+ * Parameter:       position (const char *)        -> Anfang der ersten Zeile
+ * Parameter:       end (const char *)             -> Ende der Datei
+ * Parameter:       grid (uint8_t[GRID_CELLS])           -> Enthält nach dem Funktionsaufruf das Rätsel
+ * Parameter:       stop (const char **)           -> Enthält bei einem Fehler den Anfang der letzten Zeile des Rätsels
+ *
+ * Rückgabewert:    Gibt die Position nach dem gelesenen Rätsel zurück oder NULL bei einem Fehler
+ *
+ * Beschreibung:    Liest ein Rätsel im Format "i,i,i,i,i,i,i,i,i" (SIZE Zeilen) oder mit allen Werten in einer Zeile.
+ *                  Jede Zeile muss vollständige Reihen enthalten. Nach einem Fehler steht reader->line auf der Zeile,
+ *                  in der der Fehler gefunden wurde; die übrigen Zeilen des Rätsels werden erst danach mitgezählt.
+ */
+static const char *scanCommaGrid(struct puzzleReader *reader, const char *position, const char *end, uint8_t grid[GRID_CELLS],
+                                 const char **stop) {
+    const char *line;
+    int count, value, fields, lines, errorLine;
+
+    count = 0;
+    fields = 0;
+    lines = 1;
+
+    for (;;) {
+        line = position;
+
+        // Eine Zeile: Werte durch Kommas getrennt, ein Komma am Zeilenende ist erlaubt
+        while (!isLineEnd(position = skipBlanks(position, end), end)) {
+            value = position < end ? cellValue(*position) : -1;
+
+            if (value < 0 || count == GRID_CELLS) {
+                break;
+            }
+
+            grid[count++] = (uint8_t) value;
+            position = skipBlanks(position + 1, end);
+
+            if (position < end && *position == ',') {
+                position++;
+            } else if (!isLineEnd(position, end)) {
+                break;
+            }
+        }
+
+        if (!isLineEnd(position, end) || count == 0 || count % SIZE != 0) {
+            // Die Zeilennummer des Fehlers bleibt erhalten, der Leser zählt die übersprungenen Zeilen danach weiter
+            errorLine = reader->line;
+            skipCommaGrid(reader, line, end, fields != 0 ? fields : countFields(line, end), lines, stop);
+            reader->skipped = reader->line - errorLine;
+            reader->line = errorLine;
+
+            return NULL;
+        }
+
+        if (count == GRID_CELLS) {
+            return position;
+        }
+
+        if (fields == 0) {
+            fields = count;
+        }
+
+        // Das Rätsel geht in der nächsten Zeile weiter
+        position = skipLine(position, end);
+
+        if (position >= end) {
+            *stop = line;
+            return NULL;
+        }
+
+        lines++;
+        reader->line++;
+    }
+}
+
+/**
+ * Funktion:        readPuzzle
+ *
+ * Parameter:       reader (struct puzzleReader *) -> Geöffnete Datei
+ * Parameter:       grid (uint8_t[GRID_CELLS])           -> Enthält nach dem Funktionsaufruf das Rätsel (zeilenweise, 0 = leer)
+ * Parameter:       solution (uint8_t[GRID_CELLS])       -> Enthält nach dem Funktionsaufruf die Lösung, falls sie in der Datei steht
+ * Parameter:       hasSolution (int *)            -> Enthält nach dem Funktionsaufruf eine 1, wenn eine Lösung gelesen wurde
+ *
+ * Rückgabewert:    Gibt READER_PUZZLE, READER_END oder READER_ERROR zurück. Bei einem Fehler enthält reader->line die Zeilennummer.
+ *
+ * Beschreibung:    Liest das nächste Rätsel in einem Durchlauf ohne stdio. Unterstützt werden Zeilen mit GRID_CELLS Zeichen
+ *                  ('.' oder '0' = leer, optional gefolgt von der Lösung) und das kommagetrennte Format. Leere Zeilen und
+ *                  Zeilen, die mit '#' beginnen, werden übersprungen.
+ */
+int readPuzzle(struct puzzleReader *reader, uint8_t grid[GRID_CELLS], uint8_t solution[GRID_CELLS], int *hasSolution) {
+    const char *position, *end, *next, *stop;
+
+    position = reader->data + reader->position;
+    end = reader->data + reader->size;
+    *hasSolution = 0;
+
+    // Zeilen eines fehlerhaften Rätsels, die beim letzten Aufruf übersprungen wurden
+    reader->line += reader->skipped;
+    reader->skipped = 0;
+
+    // Leere Zeilen und Kommentare überspringen
+    for (;;) {
+        if (position >= end) {
+            reader->position = reader->size;
+            return READER_END;
+        }
+
+        reader->line++;
+        next = skipBlanks(position, end);
+
+        if (!isLineEnd(next, end) && *next != '#') {
+            break;
+        }
+
+        position = skipLine(next, end);
+    }
+
+    position = next;
+
+    stop = position;
+
+    if (isCellLine(position, end)) {
+        next = scanCellLine(position, end, grid, solution, hasSolution);
+    } else {
+        next = scanCommaGrid(reader, position, end, grid, &stop);
+    }
+
+    // Bei einem Fehler wird das fehlerhafte Rätsel bis zu seiner letzten Zeile übersprungen
+    if (next == NULL) {
+        reader->position = (size_t) (skipLine(stop, end) - reader->data);
+        return READER_ERROR;
+    }
+
+    reader->position = (size_t) (skipLine(next, end) - reader->data);
+
+    INSTRUMENT_COUNT(COUNTER_PUZZLES_PARSED, 1);
+
+    return READER_PUZZLE;
+}
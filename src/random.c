@@ -0,0 +1,105 @@
+#include "../header/sudokuCore.h"
+
+// Zufallsgenerator der Spielsitzung (wird in init() initialisiert)
+static struct random sessionRandom;
+
+/**
+ * Funktion:        seedRandom
+ *
+ * Parameter:       random (struct random *) -> Zufallsgenerator
+ * Parameter:       seed (uint64_t)          -> Startwert
+ *
+ * Beschreibung:    Initialisiert einen Zufallsgenerator (Gegenstück zu srand()). Gleicher Startwert ergibt dieselbe Folge.
+ */
+void seedRandom(struct random *random, uint64_t seed) {
+    uint64_t value;
+    int i;
+
+    // Zustand mit SplitMix64 füllen, damit auch benachbarte Startwerte unabhängige Folgen liefern und der Zustand nie 0 ist
+    for (i = 0; i < 4; i++) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        value = seed;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        random->state[i] = value ^ (value >> 31);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        rotateLeft
+ *
+ * Parameter:       value (uint64_t) -> Wert
+ * Parameter:       bits (int)       -> Anzahl der Bits (1 - 63)
+ *
+ * Rückgabewert:    Gibt den um 'bits' nach links rotierten Wert zurück
+ */
+static uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * Funktion:        getRandom64
+ *
+ * Parameter:       random (struct random *) -> Zufallsgenerator
+ *
+ * Rückgabewert:    Gibt eine Zufallszahl von 0 bis 2^64 - 1 zurück
+ *
+ * Beschreibung:    Liefert die nächste Zahl aus dem Generator (xoshiro256**).
+ */
+uint64_t getRandom64(struct random *random) {
+    uint64_t *state = random->state;
+    uint64_t result, temp;
+
+    result = rotateLeft(state[1] * 5, 7) * 9;
+    temp = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= temp;
+    state[3] = rotateLeft(state[3], 45);
+
+    return result;
+}
+
+/**
+ * Funktion:        getRandomBelow
+ *
+ * Parameter:       random (struct random *) -> Zufallsgenerator
+ * Parameter:       bound (int)              -> Obergrenze (mindestens 1)
+ *
+ * Rückgabewert:    Gibt eine gleichverteilte Zufallszahl von 0 bis bound - 1 zurück
+ *
+ * Beschreibung:    Ersetzt 'rand() % bound' ohne dessen Verzerrung (Multiplikationsverfahren nach Lemire). Eine zweite Zahl
+ *                  wird nur in seltenen Fällen (Wahrscheinlichkeit bound / 2^32) benötigt.
+ */
+int getRandomBelow(struct random *random, int bound) {
+    uint64_t product;
+    uint32_t threshold;
+
+    product = (getRandom64(random) >> 32) * (uint32_t) bound;
+
+    if ((uint32_t) product < (uint32_t) bound) {
+        threshold = (uint32_t) -bound % (uint32_t) bound;
+
+        while ((uint32_t) product < threshold) {
+            product = (getRandom64(random) >> 32) * (uint32_t) bound;
+        }
+    }
+
+    return (int) (product >> 32);
+}
+
+/**
+ * Funktion:        getSessionRandom
+ *
+ * Rückgabewert:    Gibt den Zufallsgenerator der Spielsitzung zurück
+ *
+ * Beschreibung:    Generator für die Oberfläche. Startwert wird in init() gesetzt (Aufrufparameter --seed oder Uhrzeit).
+ */
+struct random *getSessionRandom() {
+    return &sessionRandom;
+}
@@ -0,0 +1,953 @@
+#include "../header/sudokuCore.h"
+
+// Gewicht je Technik für die Punktzahl (Index = TECHNIQUE_*)
+static const int techniqueWeight[TECHNIQUE_COUNT] = {0, 1, 2, 6, 10, 12, 16, 18, 24, 32, 36, 45};
+
+// Anzeigenamen der Techniken (Index = TECHNIQUE_*)
+static const char *techniqueNames[TECHNIQUE_COUNT] = {
+    "-", "Naked Single", "Hidden Single", "Locked Candidates", "Naked Pair", "Hidden Pair",
+    "Naked Triple", "Hidden Triple", "X-Wing", "Swordfish", "XY-Wing", "XY-Chain"
+};
+
+/**
+ * Funktion:        inUnit
+ *
+ * Parameter:       cell (int) -> Index des Feldes
+ * Parameter:       unit (int) -> Index der Einheit (Zeilen, danach Spalten, danach Blöcke)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn das Feld zur Einheit gehört, andernfalls eine 0
+ */
+static int inUnit(int cell, int unit) {
+    if (unit < SIZE) {
+        return rowOf[cell] == unit;
+    } else if (unit < 2 * SIZE) {
+        return columnOf[cell] == unit - SIZE;
+    }
+
+    return boxOf[cell] == unit - 2 * SIZE;
+}
+
+/**
+ * Funktion:        seesCell
+ *
+ * Parameter:       first (int)  -> Index des ersten Feldes
+ * Parameter:       second (int) -> Index des zweiten Feldes
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn beide Felder verschieden sind und eine Einheit teilen, andernfalls eine 0
+ */
+static int seesCell(int first, int second) {
+    return first != second
+        && (rowOf[first] == rowOf[second] || columnOf[first] == columnOf[second] || boxOf[first] == boxOf[second]);
+}
+
+/**
+ * Funktion:        nextCombination
+ *
+ * Parameter:       index (int[])  -> Aktuelle Auswahl (aufsteigend), wird auf die nächste Auswahl gesetzt
+ * Parameter:       size (int)     -> Anzahl ausgewählter Elemente
+ * Parameter:       count (int)    -> Anzahl der Elemente insgesamt
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn es keine weitere Auswahl gibt, andernfalls eine 1
+ *
+ * Beschreibung:    Zählt alle Auswahlen von 'size' aus 'count' Elementen in lexikographischer Reihenfolge auf.
+ *                  Die erste Auswahl (0, 1, ..., size - 1) setzt der Aufrufer.
+ */
+static int nextCombination(int index[], int size, int count) {
+    int i, j;
+
+    i = size - 1;
+
+    while (i >= 0 && index[i] == count - size + i) {
+        i--;
+    }
+
+    if (i < 0) {
+        return 0;
+    }
+
+    index[i]++;
+
+    for (j = i + 1; j < size; j++) {
+        index[j] = index[j - 1] + 1;
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        placeValue
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       cell (int)                 -> Index des Feldes
+ * Parameter:       value (int)                -> Ziffer (1 - SIZE)
+ *
+ * Beschreibung:    Setzt eine Ziffer und streicht sie aus den Kandidaten von Zeile, Spalte und Block.
+ */
+static void placeValue(struct ratingGrid *grid, int cell, int value) {
+    int units[3], i, j;
+    digitMask bit;
+
+    bit = (digitMask) (1 << (value - 1));
+    units[0] = rowOf[cell];
+    units[1] = SIZE + columnOf[cell];
+    units[2] = 2 * SIZE + boxOf[cell];
+
+    grid->value[cell] = (uint8_t) value;
+    grid->candidates[cell] = 0;
+    grid->emptyCount--;
+
+    for (i = 0; i < 3; i++) {
+        for (j = 0; j < SIZE; j++) {
+            grid->candidates[unitCells[units[i]][j]] &= ~bit;
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        eliminate
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       cell (int)                 -> Index des Feldes
+ * Parameter:       mask (digitMask)           -> Zu streichende Kandidaten
+ *
+ * Rückgabewert:    Gibt die Anzahl tatsächlich gestrichener Kandidaten zurück
+ */
+static int eliminate(struct ratingGrid *grid, int cell, digitMask mask) {
+    digitMask removed;
+
+    removed = grid->candidates[cell] & mask;
+    grid->candidates[cell] &= ~mask;
+
+    return __builtin_popcount(removed);
+}
+
+/**
+ * Funktion:        findNakedSingle
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Ein Feld mit nur noch einem Kandidaten.
+ */
+static int findNakedSingle(struct ratingGrid *grid, struct ratingStep *step) {
+    int cell;
+    digitMask candidates;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        candidates = grid->candidates[cell];
+
+        if (candidates != 0 && (candidates & (candidates - 1)) == 0) {
+            step->cell = cell;
+            step->value = __builtin_ctz(candidates) + 1;
+            placeValue(grid, cell, step->value);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        findHiddenSingle
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Eine Ziffer, die in einer Einheit nur noch in einem Feld möglich ist.
+ */
+static int findHiddenSingle(struct ratingGrid *grid, struct ratingStep *step) {
+    int unit, i, cell;
+    digitMask once, twice, hidden;
+
+    for (unit = 0; unit < UNITS; unit++) {
+        once = 0;
+        twice = 0;
+
+        for (i = 0; i < SIZE; i++) {
+            twice |= once & grid->candidates[unitCells[unit][i]];
+            once |= grid->candidates[unitCells[unit][i]];
+        }
+
+        hidden = once & ~twice;
+
+        if (hidden == 0) {
+            continue;
+        }
+
+        hidden &= -hidden;
+
+        for (i = 0; i < SIZE; i++) {
+            cell = unitCells[unit][i];
+
+            if (grid->candidates[cell] & hidden) {
+                step->cell = cell;
+                step->value = __builtin_ctz(hidden) + 1;
+                placeValue(grid, cell, step->value);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        findLockedCandidates
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Liegen alle Kandidaten einer Ziffer eines Blocks in einer Zeile oder Spalte (Pointing), kann die Ziffer
+ *                  im Rest dieser Zeile oder Spalte gestrichen werden. Umgekehrt für Zeilen und Spalten, deren Kandidaten
+ *                  in einem Block liegen (Claiming).
+ */
+static int findLockedCandidates(struct ratingGrid *grid, struct ratingStep *step) {
+    int unit, target, digit, i, cell, first, sameRow, sameColumn, sameBox, count;
+    digitMask bit;
+
+    for (unit = 0; unit < UNITS; unit++) {
+        for (digit = 0; digit < SIZE; digit++) {
+            bit = (digitMask) (1 << digit);
+            first = -1;
+            sameRow = 1;
+            sameColumn = 1;
+            sameBox = 1;
+
+            for (i = 0; i < SIZE; i++) {
+                cell = unitCells[unit][i];
+
+                if (!(grid->candidates[cell] & bit)) {
+                    continue;
+                }
+
+                if (first < 0) {
+                    first = cell;
+                } else {
+                    sameRow &= rowOf[cell] == rowOf[first];
+                    sameColumn &= columnOf[cell] == columnOf[first];
+                    sameBox &= boxOf[cell] == boxOf[first];
+                }
+            }
+
+            if (first < 0) {
+                continue;
+            }
+
+            // Die Einheit, in der gestrichen werden kann
+            if (unit >= 2 * SIZE && sameRow) {
+                target = rowOf[first];
+            } else if (unit >= 2 * SIZE && sameColumn) {
+                target = SIZE + columnOf[first];
+            } else if (unit < 2 * SIZE && sameBox) {
+                target = 2 * SIZE + boxOf[first];
+            } else {
+                continue;
+            }
+
+            count = 0;
+
+            for (i = 0; i < SIZE; i++) {
+                cell = unitCells[target][i];
+
+                if (!inUnit(cell, unit)) {
+                    count += eliminate(grid, cell, bit);
+                }
+            }
+
+            if (count > 0) {
+                step->eliminations = count;
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        findNakedSubset
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       size (int)                 -> 2 = Naked Pair, 3 = Naked Triple
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Teilen sich 'size' Felder einer Einheit zusammen genau 'size' Kandidaten, können diese Kandidaten
+ *                  in den übrigen Feldern der Einheit gestrichen werden.
+ */
+static int findNakedSubset(struct ratingGrid *grid, int size, struct ratingStep *step) {
+    int unit, i, cells[SIZE], cellCount, index[3], count;
+    digitMask candidates, combined;
+
+    for (unit = 0; unit < UNITS; unit++) {
+        cellCount = 0;
+
+        for (i = 0; i < SIZE; i++) {
+            candidates = grid->candidates[unitCells[unit][i]];
+
+            if (candidates != 0 && __builtin_popcount(candidates) <= size) {
+                cells[cellCount++] = unitCells[unit][i];
+            }
+        }
+
+        if (cellCount < size) {
+            continue;
+        }
+
+        for (i = 0; i < size; i++) {
+            index[i] = i;
+        }
+
+        do {
+            combined = 0;
+
+            for (i = 0; i < size; i++) {
+                combined |= grid->candidates[cells[index[i]]];
+            }
+
+            if (__builtin_popcount(combined) != size) {
+                continue;
+            }
+
+            count = 0;
+
+            for (i = 0; i < SIZE; i++) {
+                if ((grid->candidates[unitCells[unit][i]] & ~combined) != 0) {
+                    count += eliminate(grid, unitCells[unit][i], combined);
+                }
+            }
+
+            if (count > 0) {
+                step->eliminations = count;
+                return 1;
+            }
+        } while (nextCombination(index, size, cellCount));
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        findHiddenSubset
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       size (int)                 -> 2 = Hidden Pair, 3 = Hidden Triple
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Kommen 'size' Ziffern einer Einheit zusammen nur in 'size' Feldern vor, können alle anderen
+ *                  Kandidaten dieser Felder gestrichen werden.
+ */
+static int findHiddenSubset(struct ratingGrid *grid, int size, struct ratingStep *step) {
+    int unit, digit, i, digits[SIZE], digitCount, index[3], count;
+    digitMask where[SIZE], positions, keep;
+
+    for (unit = 0; unit < UNITS; unit++) {
+        // Positionen (Bit i = i-tes Feld der Einheit) jeder Ziffer
+        for (digit = 0; digit < SIZE; digit++) {
+            where[digit] = 0;
+
+            for (i = 0; i < SIZE; i++) {
+                if (grid->candidates[unitCells[unit][i]] & (1 << digit)) {
+                    where[digit] |= (digitMask) (1 << i);
+                }
+            }
+        }
+
+        digitCount = 0;
+
+        for (digit = 0; digit < SIZE; digit++) {
+            if (where[digit] != 0 && __builtin_popcount(where[digit]) <= size) {
+                digits[digitCount++] = digit;
+            }
+        }
+
+        if (digitCount < size) {
+            continue;
+        }
+
+        for (i = 0; i < size; i++) {
+            index[i] = i;
+        }
+
+        do {
+            positions = 0;
+            keep = 0;
+
+            for (i = 0; i < size; i++) {
+                positions |= where[digits[index[i]]];
+                keep |= (digitMask) (1 << digits[index[i]]);
+            }
+
+            if (__builtin_popcount(positions) != size) {
+                continue;
+            }
+
+            count = 0;
+
+            for (i = 0; i < SIZE; i++) {
+                if (positions & (1 << i)) {
+                    count += eliminate(grid, unitCells[unit][i], (digitMask) (ALL_DIGITS & ~keep));
+                }
+            }
+
+            if (count > 0) {
+                step->eliminations = count;
+                return 1;
+            }
+        } while (nextCombination(index, size, digitCount));
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        findFish
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       size (int)                 -> 2 = X-Wing, 3 = Swordfish
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Liegen die Kandidaten einer Ziffer in 'size' Zeilen zusammen in nur 'size' Spalten, kann die Ziffer
+ *                  in diesen Spalten aus allen anderen Zeilen gestrichen werden (und umgekehrt mit Spalten als Basis).
+ */
+static int findFish(struct ratingGrid *grid, int size, struct ratingStep *step) {
+    int digit, transposed, line, cover, cell, lines[SIZE], lineCount, index[3], i, count, isBase;
+    digitMask bit, where[SIZE], covers;
+
+    for (digit = 0; digit < SIZE; digit++) {
+        bit = (digitMask) (1 << digit);
+
+        for (transposed = 0; transposed < 2; transposed++) {
+            lineCount = 0;
+
+            for (line = 0; line < SIZE; line++) {
+                where[line] = 0;
+
+                for (cover = 0; cover < SIZE; cover++) {
+                    cell = transposed ? cover * SIZE + line : line * SIZE + cover;
+
+                    if (grid->candidates[cell] & bit) {
+                        where[line] |= (digitMask) (1 << cover);
+                    }
+                }
+
+                if (where[line] != 0 && __builtin_popcount(where[line]) <= size) {
+                    lines[lineCount++] = line;
+                }
+            }
+
+            if (lineCount < size) {
+                continue;
+            }
+
+            for (i = 0; i < size; i++) {
+                index[i] = i;
+            }
+
+            do {
+                covers = 0;
+
+                for (i = 0; i < size; i++) {
+                    covers |= where[lines[index[i]]];
+                }
+
+                if (__builtin_popcount(covers) != size) {
+                    continue;
+                }
+
+                count = 0;
+
+                for (line = 0; line < SIZE; line++) {
+                    isBase = 0;
+
+                    for (i = 0; i < size; i++) {
+                        isBase |= lines[index[i]] == line;
+                    }
+
+                    if (isBase) {
+                        continue;
+                    }
+
+                    for (cover = 0; cover < SIZE; cover++) {
+                        if (covers & (1 << cover)) {
+                            count += eliminate(grid, transposed ? cover * SIZE + line : line * SIZE + cover, bit);
+                        }
+                    }
+                }
+
+                if (count > 0) {
+                    step->eliminations = count;
+                    return 1;
+                }
+            } while (nextCombination(index, size, lineCount));
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        findXYWing
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Ein Feld {a, b} sieht zwei Felder {a, c} und {b, c}. Eines der beiden ist dann immer c, also kann c
+ *                  in allen Feldern gestrichen werden, die beide sehen.
+ */
+static int findXYWing(struct ratingGrid *grid, struct ratingStep *step) {
+    int pairs[GRID_CELLS], pairCount, pivot, first, second, cell, i, j, count;
+    digitMask shared, other, target;
+
+    pairCount = 0;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        if (__builtin_popcount(grid->candidates[cell]) == 2) {
+            pairs[pairCount++] = cell;
+        }
+    }
+
+    for (pivot = 0; pivot < pairCount; pivot++) {
+        for (i = 0; i < pairCount; i++) {
+            first = pairs[i];
+            shared = grid->candidates[first] & grid->candidates[pairs[pivot]];
+
+            if (!seesCell(pairs[pivot], first) || __builtin_popcount(shared) != 1) {
+                continue;
+            }
+
+            target = grid->candidates[first] & ~shared;
+            other = grid->candidates[pairs[pivot]] & ~shared;
+
+            for (j = 0; j < pairCount; j++) {
+                second = pairs[j];
+
+                if (grid->candidates[second] != (other | target) || !seesCell(pairs[pivot], second)) {
+                    continue;
+                }
+
+                count = 0;
+
+                for (cell = 0; cell < GRID_CELLS; cell++) {
+                    if (seesCell(cell, first) && seesCell(cell, second)) {
+                        count += eliminate(grid, cell, target);
+                    }
+                }
+
+                if (count > 0) {
+                    step->eliminations = count;
+                    return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        findXYChain
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den Schritt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Technik angewendet wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Kette aus Feldern mit je zwei Kandidaten: Ist das Startfeld nicht z, legt das die Werte aller folgenden
+ *                  Felder fest. Endet die Kette in einem Feld, das dann z sein muss, ist eines der beiden Enden z und z kann
+ *                  in allen Feldern gestrichen werden, die beide Enden sehen. Breitensuche je Startfeld und Ziffer.
+ */
+static int findXYChain(struct ratingGrid *grid, struct ratingStep *step) {
+    int pairs[GRID_CELLS], pairCount, start, cell, next, peer, head, tail, i, count;
+    int queueCell[GRID_CELLS * 2], queueDigit[GRID_CELLS * 2];
+    digitMask visited[GRID_CELLS];
+    digitMask target, forced, other;
+
+    pairCount = 0;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        if (__builtin_popcount(grid->candidates[cell]) == 2) {
+            pairs[pairCount++] = cell;
+        }
+    }
+
+    for (start = 0; start < pairCount; start++) {
+        for (target = grid->candidates[pairs[start]]; target != 0; target &= target - 1) {
+            // Ist das Startfeld nicht z, ist es der andere Kandidat
+            memset(visited, 0, sizeof(visited));
+            head = 0;
+            tail = 0;
+            queueCell[tail] = pairs[start];
+            queueDigit[tail++] = grid->candidates[pairs[start]] & ~(target & -target);
+            visited[pairs[start]] = (digitMask) queueDigit[0];
+
+            while (head < tail) {
+                cell = queueCell[head];
+                forced = (digitMask) queueDigit[head++];
+
+                for (i = 0; i < pairCount; i++) {
+                    next = pairs[i];
+
+                    // Das nächste Feld sieht das aktuelle und verliert dessen Wert
+                    if (next == pairs[start] || !(grid->candidates[next] & forced) || !seesCell(cell, next)) {
+                        continue;
+                    }
+
+                    other = grid->candidates[next] & ~forced;
+
+                    if (visited[next] & other) {
+                        continue;
+                    }
+
+                    if (other == (target & -target)) {
+                        count = 0;
+
+                        for (peer = 0; peer < GRID_CELLS; peer++) {
+                            if (seesCell(peer, pairs[start]) && seesCell(peer, next)) {
+                                count += eliminate(grid, peer, other);
+                            }
+                        }
+
+                        if (count > 0) {
+                            step->eliminations = count;
+                            return 1;
+                        }
+                    }
+
+                    visited[next] |= other;
+                    queueCell[tail] = next;
+                    queueDigit[tail++] = other;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        initRatingGrid
+ *
+ * Parameter:       grid (struct ratingGrid *)        -> Gitter, welches initialisiert wird
+ * Parameter:       values (const uint8_t[GRID_CELLS])        -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn das Gitter ungültige Werte oder doppelte Ziffern enthält, andernfalls eine 1
+ *
+ * Beschreibung:    Überträgt ein Gitter und bildet die Kandidaten aller leeren Felder.
+ */
+int initRatingGrid(struct ratingGrid *grid, const uint8_t values[GRID_CELLS]) {
+    int cell;
+
+    grid->emptyCount = GRID_CELLS;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        grid->value[cell] = 0;
+        grid->candidates[cell] = ALL_DIGITS;
+    }
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        if (values[cell] == 0) {
+            continue;
+        }
+
+        // Ziffer ist ungültig oder steht bereits in Zeile, Spalte oder Block
+        if (values[cell] > SIZE || !(grid->candidates[cell] & (1 << (values[cell] - 1)))) {
+            return 0;
+        }
+
+        placeValue(grid, cell, values[cell]);
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        initRatingGridFromBoard
+ *
+ * Parameter:       grid (struct ratingGrid *)     -> Gitter, welches initialisiert wird
+ * Parameter:       board (const struct board *)   -> Spielfeld mit aktuellen Belegungsmasken
+ *
+ * Beschreibung:    Wie 'initRatingGrid', übernimmt die Kandidaten aber direkt aus den laufend gepflegten Masken des
+ *                  Spielfeldes (ein Durchlauf über die Felder statt einer Platzierung je Wert). Das Spielfeld sollte keine
+ *                  doppelten Ziffern enthalten, sonst sind die Kandidaten nicht aussagekräftig.
+ */
+void initRatingGridFromBoard(struct ratingGrid *grid, const struct board *board) {
+    int cell;
+
+    grid->emptyCount = 0;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        grid->value[cell] = board->value[cell];
+
+        if (board->value[cell] == 0) {
+            grid->candidates[cell] = getBoardCandidates(board, cell);
+            grid->emptyCount++;
+        } else {
+            grid->candidates[cell] = 0;
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        applyRatingStepUpTo
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den angewendeten Schritt
+ * Parameter:       hardest (int)              -> Schwierigste Technik, die probiert wird
+ *
+ * Rückgabewert:    Gibt die angewendete Technik zurück (TECHNIQUE_NONE = kein Schritt bis 'hardest' möglich)
+ *
+ * Beschreibung:    Sucht den leichtesten möglichen Schritt bis einschließlich 'hardest' und wendet ihn an.
+ */
+static int applyRatingStepUpTo(struct ratingGrid *grid, struct ratingStep *step, int hardest) {
+    int technique, found;
+
+    step->cell = -1;
+    step->value = 0;
+    step->eliminations = 0;
+
+    for (technique = TECHNIQUE_NAKED_SINGLE; technique <= hardest; technique++) {
+        switch (technique) {
+            case TECHNIQUE_NAKED_SINGLE:
+                found = findNakedSingle(grid, step);
+                break;
+
+            case TECHNIQUE_HIDDEN_SINGLE:
+                found = findHiddenSingle(grid, step);
+                break;
+
+            case TECHNIQUE_LOCKED_CANDIDATES:
+                found = findLockedCandidates(grid, step);
+                break;
+
+            case TECHNIQUE_NAKED_PAIR:
+                found = findNakedSubset(grid, 2, step);
+                break;
+
+            case TECHNIQUE_HIDDEN_PAIR:
+                found = findHiddenSubset(grid, 2, step);
+                break;
+
+            case TECHNIQUE_NAKED_TRIPLE:
+                found = findNakedSubset(grid, 3, step);
+                break;
+
+            case TECHNIQUE_HIDDEN_TRIPLE:
+                found = findHiddenSubset(grid, 3, step);
+                break;
+
+            case TECHNIQUE_X_WING:
+                found = findFish(grid, 2, step);
+                break;
+
+            case TECHNIQUE_SWORDFISH:
+                found = findFish(grid, 3, step);
+                break;
+
+            case TECHNIQUE_XY_WING:
+                found = findXYWing(grid, step);
+                break;
+
+            case TECHNIQUE_XY_CHAIN:
+            default:
+                found = findXYChain(grid, step);
+                break;
+        }
+
+        if (found) {
+            step->technique = technique;
+            return technique;
+        }
+    }
+
+    step->technique = TECHNIQUE_NONE;
+
+    return TECHNIQUE_NONE;
+}
+
+/**
+ * Funktion:        applyRatingStep
+ *
+ * Parameter:       grid (struct ratingGrid *) -> Gitter mit Kandidaten
+ * Parameter:       step (struct ratingStep *) -> Enthält nach dem Funktionsaufruf den angewendeten Schritt
+ *
+ * Rückgabewert:    Gibt die angewendete Technik zurück (TECHNIQUE_NONE = kein logischer Schritt möglich)
+ *
+ * Beschreibung:    Sucht den leichtesten möglichen Schritt und wendet ihn an. Wie ein Spieler wird jede Technik erst
+ *                  probiert, wenn alle leichteren nichts mehr ergeben.
+ */
+int applyRatingStep(struct ratingGrid *grid, struct ratingStep *step) {
+    return applyRatingStepUpTo(grid, step, TECHNIQUE_COUNT - 1);
+}
+
+/**
+ * Funktion:        ratePuzzle
+ *
+ * Parameter:       values (const uint8_t[GRID_CELLS])  -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ * Parameter:       stepBudget (int)            -> Höchstzahl an Schritten (z.B. RATING_STEP_BUDGET)
+ * Parameter:       rating (struct rating *)    -> Enthält nach dem Funktionsaufruf die Bewertung
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn das Gitter ungültig ist, andernfalls eine 1
+ *
+ * Beschreibung:    Löst das Sudoku nur mit menschlichen Techniken und bewertet es nach der schwierigsten benötigten
+ *                  Technik und der Summe der Schrittgewichte. Ohne Raten und Backtracking; reichen die Techniken oder das
+ *                  Budget nicht, ist 'solved' 0.
+ */
+int ratePuzzle(const uint8_t values[GRID_CELLS], int stepBudget, struct rating *rating) {
+    struct ratingGrid grid;
+    struct ratingStep step;
+    int technique;
+
+    INSTRUMENT_BEGIN(TIMER_RATE);
+    INSTRUMENT_COUNT(COUNTER_RATINGS, 1);
+    memset(rating, 0, sizeof(*rating));
+
+    if (!initRatingGrid(&grid, values)) {
+        return 0;
+    }
+
+    while (grid.emptyCount > 0 && rating->steps < stepBudget) {
+        technique = applyRatingStep(&grid, &step);
+
+        if (technique == TECHNIQUE_NONE) {
+            break;
+        }
+
+        rating->steps++;
+        rating->uses[technique]++;
+        rating->score += techniqueWeight[technique];
+
+        if (technique > rating->hardest) {
+            rating->hardest = technique;
+        }
+    }
+
+    rating->solved = grid.emptyCount == 0;
+    INSTRUMENT_END(TIMER_RATE);
+
+    return 1;
+}
+
+/**
+ * Funktion:        ratePuzzleDifficulty
+ *
+ * Parameter:       values (const uint8_t[GRID_CELLS]) -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ * Parameter:       stepBudget (int)                   -> Höchstzahl an Schritten (z.B. RATING_STEP_BUDGET)
+ *
+ * Rückgabewert:    Gibt den Schwierigkeitsgrad zurück (EASY, MEDIUM oder DIFFICULT, 0 = ungültiges Gitter)
+ *
+ * Beschreibung:    Liefert dasselbe Ergebnis wie 'ratePuzzle' mit 'ratingToDifficulty', bricht aber ab, sobald ein Schritt
+ *                  schwerer als Hidden Triple nötig ist: Ab da steht DIFFICULT fest, Fische, Wings und Ketten werden nicht gesucht.
+ *                  Für das Ausdünnen, das nur den Schwierigkeitsgrad braucht.
+ */
+int ratePuzzleDifficulty(const uint8_t values[GRID_CELLS], int stepBudget) {
+    struct ratingGrid grid;
+    struct ratingStep step;
+    int technique, steps, difficulty;
+
+    INSTRUMENT_BEGIN(TIMER_RATE);
+    INSTRUMENT_COUNT(COUNTER_RATINGS, 1);
+    difficulty = 0;
+
+    if (initRatingGrid(&grid, values)) {
+        difficulty = EASY;
+
+        for (steps = 0; grid.emptyCount > 0 && steps < stepBudget; steps++) {
+            technique = applyRatingStepUpTo(&grid, &step, TECHNIQUE_X_WING - 1);
+
+            if (technique == TECHNIQUE_NONE) {
+                break;
+            }
+
+            if (technique >= TECHNIQUE_LOCKED_CANDIDATES) {
+                difficulty = MEDIUM;
+            }
+        }
+
+        if (grid.emptyCount > 0) {
+            difficulty = DIFFICULT;
+        }
+    }
+
+    INSTRUMENT_END(TIMER_RATE);
+
+    return difficulty;
+}
+
+/**
+ * Funktion:        rateSudoku
+ *
+ * Parameter:       sudokuGrid (const struct sudoku *) -> Spielbares Sudoku
+ * Parameter:       rating (struct rating *)           -> Enthält nach dem Funktionsaufruf die Bewertung
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn das Sudoku ungültig ist, andernfalls eine 1
+ *
+ * Beschreibung:    Gegenstück zu 'ratePuzzle' für die Struktur 'sudoku' mit dem Standardbudget.
+ */
+int rateSudoku(const struct sudoku *sudokuGrid, struct rating *rating) {
+    uint8_t values[GRID_CELLS];
+    int i;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        if (sudokuGrid->value[i / SIZE][i % SIZE] < 0 || sudokuGrid->value[i / SIZE][i % SIZE] > SIZE) {
+            memset(rating, 0, sizeof(*rating));
+            return 0;
+        }
+
+        values[i] = (uint8_t) sudokuGrid->value[i / SIZE][i % SIZE];
+    }
+
+    return ratePuzzle(values, RATING_STEP_BUDGET, rating);
+}
+
+/**
+ * Funktion:        ratingToDifficulty
+ *
+ * Parameter:       rating (const struct rating *) -> Bewertung
+ *
+ * Rückgabewert:    Gibt den Schwierigkeitsgrad zurück (EASY, MEDIUM oder DIFFICULT)
+ *
+ * Beschreibung:    Leicht = nur Singles, Mittel = Locked Candidates und Paare/Tripel, Schwer = Fische, Wings, Ketten
+ *                  oder mit den Techniken nicht lösbar.
+ */
+int ratingToDifficulty(const struct rating *rating) {
+    if (!rating->solved || rating->hardest >= TECHNIQUE_X_WING) {
+        return DIFFICULT;
+    } else if (rating->hardest >= TECHNIQUE_LOCKED_CANDIDATES) {
+        return MEDIUM;
+    }
+
+    return EASY;
+}
+
+/**
+ * Funktion:        getTechniqueName
+ *
+ * Parameter:       technique (int) -> TECHNIQUE_*
+ *
+ * Rückgabewert:    Gibt den Anzeigenamen der Technik zurück
+ */
+const char *getTechniqueName(int technique) {
+    if (technique < 0 || technique >= TECHNIQUE_COUNT) {
+        return techniqueNames[TECHNIQUE_NONE];
+    }
+
+    return techniqueNames[technique];
+}
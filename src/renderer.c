@@ -0,0 +1,202 @@
+#include "../header/sudoku.h"
+
+// Bildpuffer, dient als Puffer von stdout
+static char frameBuffer[FRAME_BUFFER_SIZE];
+
+/**
+ * Funktion:        initRenderer
+ *
+ * Beschreibung:    Schaltet die Konsole in den VT-Modus (ANSI-Steuersequenzen) und puffert stdout vollständig im Bildpuffer.
+ *                  Ein Bild wird so erst mit 'flushScreen' (bzw. vor jeder Eingabe) in einem Schreibaufruf ausgegeben.
+ *                  Muss vor der ersten Ausgabe aufgerufen werden.
+ */
+void initRenderer() {
+    initConsole();
+    setvbuf(stdout, frameBuffer, _IOFBF, FRAME_BUFFER_SIZE);
+
+    return;
+}
+
+/**
+ * Funktion:        clearScreen
+ *
+ * Beschreibung:    Ersatz für system("cls"): Schreibt nur die Steuersequenz in den Bildpuffer, statt eine Shell zu starten.
+ */
+void clearScreen() {
+    fputs(VT_CLEAR, stdout);
+
+    return;
+}
+
+/**
+ * Funktion:        flushScreen
+ *
+ * Beschreibung:    Gibt das bislang aufgebaute Bild aus.
+ */
+void flushScreen() {
+    fflush(stdout);
+
+    return;
+}
+
+/**
+ * Funktion:        moveCursor
+ *
+ * Parameter:       row (int)    -> Bildschirmzeile (ab 1)
+ * Parameter:       column (int) -> Bildschirmspalte (ab 1)
+ *
+ * Beschreibung:    Setzt den Cursor an eine absolute Position.
+ */
+void moveCursor(int row, int column) {
+    printf("\x1b[%d;%dH", row, column);
+
+    return;
+}
+
+/**
+ * Funktion:        putCell
+ *
+ * Parameter:       board (const struct board *) -> Spielfeld
+ * Parameter:       cell (int)                   -> Index des Feldes
+ * Parameter:       *color (int)                 -> Zuletzt gesetzte Farbe (-1 = unbekannt, 0 = Spieler, 1 = vorgegeben)
+ *
+ * Beschreibung:    Gibt den Wert eines Feldes aus. Die Farbe wird nur gewechselt, wenn sie sich vom vorherigen Feld unterscheidet.
+ */
+static void putCell(const struct board *board, int cell, int *color) {
+    int given;
+
+    given = isBoardGiven(board, cell);
+
+    if (given != *color) {
+        fputs(given ? VT_COLOR_GIVEN : VT_COLOR_PLAYER, stdout);
+        *color = given;
+    }
+
+    putchar(board->value[cell] == 0 ? ' ' : valueToChar(board->value[cell]));
+
+    return;
+}
+
+/**
+ * Funktion:        printBorder
+ *
+ * Beschreibung:    Gibt eine waagrechte Rahmenlinie des Spielfeldes aus (z.B. "   +-------+-------+-------+" bei 9x9).
+ */
+static void printBorder() {
+    int box, i;
+
+    printf("%*s+", ROW_LABEL_WIDTH + 2, "");
+
+    for (box = 0; box < BOX_SIZE; box++) {
+        for (i = 0; i < 2 * BOX_SIZE + 1; i++) {
+            putchar('-');
+        }
+
+        putchar('+');
+    }
+
+    putchar('\n');
+
+    return;
+}
+
+/**
+ * Funktion:        drawGrid
+ *
+ * Parameter:       view (struct gridView *)     -> Enthält danach den dargestellten Stand
+ * Parameter:       board (const struct board *) -> Spielfeld
+ * Parameter:       top (int)                    -> Bildschirmzeile (ab 1), in der das Spielfeld beginnt (= aktuelle Cursorzeile)
+ *
+ * Beschreibung:    Gibt das ganze Spielfeld an der aktuellen Cursorposition aus (vorgegebene Felder gelb, sonst weiß).
+ */
+void drawGrid(struct gridView *view, const struct board *board, int top) {
+    int row, column, color;
+
+    color = -1;
+
+    printf("%*s", ROW_LABEL_WIDTH + 4, "");
+
+    for (column = 0; column < SIZE; column++) {
+        putchar('A' + column);
+        fputs(column == SIZE - 1 ? "\n" : column % BOX_SIZE == BOX_SIZE - 1 ? "   " : " ", stdout);
+    }
+
+    printBorder();
+
+    for (row = 0; row < SIZE; row++) {
+        printf("%*d. |", ROW_LABEL_WIDTH, row + 1);
+
+        for (column = 0; column < SIZE; column++) {
+            putchar(' ');
+            putCell(board, row * SIZE + column, &color);
+
+            if (column % BOX_SIZE == BOX_SIZE - 1) {
+                fputs(VT_COLOR_RESET " |", stdout);
+                color = -1;
+            }
+        }
+
+        putchar('\n');
+
+        if (row % BOX_SIZE == BOX_SIZE - 1) {
+            printBorder();
+        }
+    }
+
+    view->shown = *board;
+    view->top = top;
+    view->valid = 1;
+
+    return;
+}
+
+/**
+ * Funktion:        updateGrid
+ *
+ * Parameter:       view (struct gridView *)     -> Zuletzt dargestelltes Spielfeld (muss mit 'drawGrid' gezeichnet sein)
+ * Parameter:       board (const struct board *) -> Aktuelles Spielfeld
+ *
+ * Beschreibung:    Zeichnet nur die Felder neu, die sich seit der letzten Darstellung geändert haben, per Cursor-Adressierung.
+ *                  Nach einem Zug ist das meist ein einziges Feld statt des ganzen Bildschirms. Die Cursorposition ist danach
+ *                  undefiniert. Setzt voraus, dass der Bildschirm seit 'drawGrid' nicht gescrollt hat (siehe 'fitsScreen').
+ */
+void updateGrid(struct gridView *view, const struct board *board) {
+    int cell, row, column, color;
+
+    color = -1;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        if (view->shown.value[cell] == board->value[cell] && isBoardGiven(&view->shown, cell) == isBoardGiven(board, cell)) {
+            continue;
+        }
+
+        // Zeile: Beschriftung und Rahmen, danach nach jedem Block ein weiterer Rahmen; Spalte: "1. | " und " | " je Block
+        row = rowOf[cell];
+        column = columnOf[cell];
+        moveCursor(view->top + 2 + row + row / BOX_SIZE, ROW_LABEL_WIDTH + 5 + column * 2 + (column / BOX_SIZE) * 2);
+        putCell(board, cell, &color);
+    }
+
+    if (color != -1) {
+        fputs(VT_COLOR_RESET, stdout);
+    }
+
+    view->shown = *board;
+
+    return;
+}
+
+/**
+ * Funktion:        fitsScreen
+ *
+ * Parameter:       view (const struct gridView *) -> Mit 'drawGrid' gezeichnetes Spielfeld
+ * Parameter:       linesBelow (int)               -> Zeilen, die unter dem Spielfeld noch ausgegeben werden
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn Spielfeld und die Zeilen darunter in die Konsole passen, andernfalls eine 0
+ *
+ * Beschreibung:    Nur dann stimmen die absoluten Zeilen von 'updateGrid'. Sonst (zu kleines Terminal, großes Spielfeld
+ *                  oder unbekannte Größe) muss das Bild ganz neu gezeichnet werden, was ebenfalls nur ein Schreibaufruf ist.
+ */
+int fitsScreen(const struct gridView *view, int linesBelow) {
+    return view->top + GRID_LINES - 1 + linesBelow <= getConsoleRows();
+}
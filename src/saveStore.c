@@ -0,0 +1,588 @@
+#include "../header/sudokuCore.h"
+
+/**
+ * Funktion:        encodeEntry
+ *
+ * Parameter:       entry (const struct saveEntry *)      -> Eintrag
+ * Parameter:       buffer (uint8_t[SAVESTORE_ENTRY_SIZE]) -> Enthält nach dem Funktionsaufruf den Eintrag im Dateiformat
+ *
+ * Beschreibung:    Name (40 Bytes), Schwierigkeitsgrad, Fortschritt, 2 Bytes reserviert, Zeit, Position, Länge,
+ *                  Speicherzeitpunkt und 4 Bytes reserviert.
+ */
+static void encodeEntry(const struct saveEntry *entry, uint8_t buffer[SAVESTORE_ENTRY_SIZE]) {
+    memset(buffer, 0, SAVESTORE_ENTRY_SIZE);
+    memcpy(buffer, entry->name, SAVESTORE_NAME_LENGTH);
+    buffer[SAVESTORE_NAME_LENGTH - 1] = '\0';
+    buffer[40] = (uint8_t) entry->difficulty;
+    buffer[41] = (uint8_t) entry->progress;
+    writeUint32(buffer + 44, entry->pastTime);
+    writeUint32(buffer + 48, entry->offset);
+    writeUint32(buffer + 52, entry->length);
+    writeUint32(buffer + 56, entry->savedAt);
+
+    return;
+}
+
+/**
+ * Funktion:        decodeEntry
+ *
+ * Parameter:       buffer (const uint8_t *)    -> Eintrag im Dateiformat
+ * Parameter:       entry (struct saveEntry *)  -> Enthält nach dem Funktionsaufruf den Eintrag
+ *
+ * Beschreibung:    Gegenstück zu 'encodeEntry'.
+ */
+static void decodeEntry(const uint8_t *buffer, struct saveEntry *entry) {
+    memcpy(entry->name, buffer, SAVESTORE_NAME_LENGTH);
+    entry->name[SAVESTORE_NAME_LENGTH - 1] = '\0';
+    entry->difficulty = buffer[40];
+    entry->progress = buffer[41];
+    entry->pastTime = readUint32(buffer + 44);
+    entry->offset = readUint32(buffer + 48);
+    entry->length = readUint32(buffer + 52);
+    entry->savedAt = readUint32(buffer + 56);
+
+    return;
+}
+
+/**
+ * Funktion:        writeAt
+ *
+ * Parameter:       store (struct saveStore *) -> Spielstand-Datei
+ * Parameter:       offset (long)              -> Position in der Datei
+ * Parameter:       data (const void *)        -> Daten
+ * Parameter:       length (size_t)            -> Anzahl der Bytes
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Daten geschrieben wurden, andernfalls eine 0
+ */
+static int writeAt(struct saveStore *store, long offset, const void *data, size_t length) {
+    int written;
+
+    INSTRUMENT_BEGIN(TIMER_SAVEGAME_IO);
+    INSTRUMENT_COUNT(COUNTER_FILE_WRITES, 1);
+
+    written = fseek(store->fileHandle, offset, SEEK_SET) == 0 && fwrite(data, 1, length, store->fileHandle) == length
+              && fflush(store->fileHandle) == 0;
+
+    INSTRUMENT_END(TIMER_SAVEGAME_IO);
+
+    return written;
+}
+
+/**
+ * Funktion:        writeHeader
+ *
+ * Parameter:       store (struct saveStore *) -> Spielstand-Datei
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Dateikopf geschrieben wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Schreibt Kennung, Version, Kapazität und Anzahl der Spielstände.
+ */
+static int writeHeader(struct saveStore *store) {
+    uint8_t header[SAVESTORE_HEADER_SIZE];
+
+    memset(header, 0, sizeof(header));
+    memcpy(header, "SKST", 4);
+    header[4] = SAVESTORE_VERSION;
+    writeUint32(header + 8, (uint32_t) store->capacity);
+    writeUint32(header + 12, (uint32_t) store->count);
+
+    return writeAt(store, 0, header, sizeof(header));
+}
+
+/**
+ * Funktion:        writeEntry
+ *
+ * Parameter:       store (struct saveStore *)       -> Spielstand-Datei
+ * Parameter:       index (int)                      -> Index des Eintrags
+ * Parameter:       entry (const struct saveEntry *) -> Eintrag, der an diese Stelle geschrieben wird
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Eintrag geschrieben wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Schreibt nur in die Datei. Der Index im Speicher wird erst nach einem erfolgreichen Schreibzugriff
+ *                  vom Aufrufer angepasst, damit er nie von der Datei abweicht.
+ */
+static int writeEntry(struct saveStore *store, int index, const struct saveEntry *entry) {
+    uint8_t buffer[SAVESTORE_ENTRY_SIZE];
+
+    encodeEntry(entry, buffer);
+
+    return writeAt(store, SAVESTORE_HEADER_SIZE + (long) index * SAVESTORE_ENTRY_SIZE, buffer, sizeof(buffer));
+}
+
+/**
+ * Funktion:        getDataStart
+ *
+ * Parameter:       store (const struct saveStore *) -> Spielstand-Datei
+ *
+ * Rückgabewert:    Gibt die Position hinter dem vollständigen Index zurück, ab der Spielstände stehen
+ */
+static long getDataStart(const struct saveStore *store) {
+    return SAVESTORE_HEADER_SIZE + (long) store->capacity * SAVESTORE_ENTRY_SIZE;
+}
+
+/**
+ * Funktion:        compareEntryOffsets
+ *
+ * Beschreibung:    Vergleichsfunktion für qsort (Einträge aufsteigend nach ihrer Position in der Datei).
+ */
+static int compareEntryOffsets(const void *first, const void *second) {
+    uint32_t a = ((const struct saveEntry *) first)->offset, b = ((const struct saveEntry *) second)->offset;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ * Funktion:        findFreeSpace
+ *
+ * Parameter:       store (struct saveStore *) -> Spielstand-Datei
+ * Parameter:       length (size_t)            -> Benötigte Anzahl der Bytes
+ *
+ * Rückgabewert:    Gibt die Position zurück, an die der Spielstand geschrieben werden kann (-1 bei einem Fehler)
+ *
+ * Beschreibung:    Sucht die erste Lücke zwischen den gültigen Spielständen, in die 'length' Bytes passen; sonst die Position
+ *                  hinter dem letzten gültigen Spielstand. Alle Spielstände im Index bleiben dabei unberührt, auch der, der
+ *                  gerade ersetzt wird: Sein Platz wird erst frei, wenn der neue Eintrag im Index steht.
+ */
+static long findFreeSpace(struct saveStore *store, size_t length) {
+    struct saveEntry *sorted;
+    long position, end;
+    int i;
+
+    position = getDataStart(store);
+
+    if (store->count == 0) {
+        return position;
+    }
+
+    sorted = malloc(sizeof(*sorted) * store->count);
+
+    // Ohne Speicher wird angehängt
+    if (sorted == NULL) {
+        if (fseek(store->fileHandle, 0, SEEK_END) != 0 || (end = ftell(store->fileHandle)) < 0) {
+            return -1;
+        }
+
+        return end > position ? end : position;
+    }
+
+    memcpy(sorted, store->entries, sizeof(*sorted) * store->count);
+    qsort(sorted, (size_t) store->count, sizeof(*sorted), compareEntryOffsets);
+
+    for (i = 0; i < store->count; i++) {
+        if ((long) sorted[i].offset - position >= (long) length) {
+            break;
+        }
+
+        end = (long) sorted[i].offset + (long) sorted[i].length;
+        position = end > position ? end : position;
+    }
+
+    free(sorted);
+
+    return position;
+}
+
+/**
+ * Funktion:        compactSaveStore
+ *
+ * Parameter:       store (struct saveStore *) -> Geöffnete Spielstand-Datei
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Datei verdichtet wurde, andernfalls eine 0 (die bisherige Datei bleibt geöffnet,
+ *                  bzw. 'store' ist geschlossen, wenn sie nicht wieder geöffnet werden konnte)
+ *
+ * Beschreibung:    Schreibt alle gültigen Spielstände lückenlos in eine temporäre Datei und ersetzt die Spielstand-Datei
+ *                  danach in einem Schritt. Nach einem Absturz liegt daher entweder die alte oder die verdichtete Datei vor.
+ */
+static int compactSaveStore(struct saveStore *store) {
+    struct saveStore compacted;
+    struct saveEntry *entries;
+    uint8_t *buffer;
+    long position;
+    int i, written;
+
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+
+    compacted = *store;
+    compacted.fileHandle = fopen(SAVESTORE_TEMP_FILE, "wb");
+    compacted.entries = entries = malloc(sizeof(*entries) * store->capacity);
+    buffer = malloc(SAVEGAME_JOURNAL_SIZE(JOURNAL_MAX_MOVES));
+    written = compacted.fileHandle != NULL && entries != NULL && buffer != NULL && writeHeader(&compacted);
+    position = getDataStart(store);
+
+    for (i = 0; written && i < store->count; i++) {
+        entries[i] = store->entries[i];
+        entries[i].offset = (uint32_t) position;
+        position += (long) entries[i].length;
+
+        INSTRUMENT_COUNT(COUNTER_FILE_READS, 1);
+
+        written = entries[i].length <= SAVEGAME_JOURNAL_SIZE(JOURNAL_MAX_MOVES)
+                  && fseek(store->fileHandle, (long) store->entries[i].offset, SEEK_SET) == 0
+                  && fread(buffer, 1, entries[i].length, store->fileHandle) == entries[i].length
+                  && writeAt(&compacted, (long) entries[i].offset, buffer, entries[i].length)
+                  && writeEntry(&compacted, i, &entries[i]);
+    }
+
+    free(buffer);
+
+    if (compacted.fileHandle != NULL) {
+        written = syncFile(compacted.fileHandle) && written;
+        written = fclose(compacted.fileHandle) == 0 && written;
+    }
+
+    if (!written) {
+        remove(SAVESTORE_TEMP_FILE);
+        free(entries);
+        return 0;
+    }
+
+    // Unter Windows kann eine geöffnete Datei nicht ersetzt werden
+    fclose(store->fileHandle);
+    written = replaceFile(SAVESTORE_TEMP_FILE, SAVESTORE_FILE);
+
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+    store->fileHandle = fopen(SAVESTORE_FILE, "r+b");
+
+    if (!written) {
+        remove(SAVESTORE_TEMP_FILE);
+        free(entries);
+
+        if (store->fileHandle == NULL) {
+            closeSaveStore(store);
+        }
+
+        return 0;
+    }
+
+    free(store->entries);
+    store->entries = entries;
+
+    if (store->fileHandle == NULL) {
+        closeSaveStore(store);
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        importLegacySlots
+ *
+ * Parameter:       store (struct saveStore *) -> Neu angelegte Spielstand-Datei
+ *
+ * Beschreibung:    Übernimmt die Spielstände aus den alten Dateien slot0.skram - slot9.skram. Die alten Dateien bleiben erhalten.
+ */
+static void importLegacySlots(struct saveStore *store) {
+    struct savegame sudoku;
+    char name[SAVESTORE_NAME_LENGTH];
+    int slot, error;
+
+    for (slot = 1; slot <= 10; slot++) {
+        sudoku = readSavegame(slot, &error);
+
+        if (error == 0) {
+            sprintf(name, "Spielstand %d", slot);
+            writeStoredSave(store, name, &sudoku, NULL);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        openSaveStore
+ *
+ * Parameter:       store (struct saveStore *) -> Enthält nach dem Funktionsaufruf die geöffnete Spielstand-Datei
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Datei geöffnet werden konnte, andernfalls eine 0
+ *
+ * Beschreibung:    Öffnet die Spielstand-Datei und liest den Index mit einem Lesezugriff ein. Existiert die Datei noch nicht,
+ *                  wird sie angelegt und die alten Slot-Dateien werden übernommen. Ist mehr Platz durch überschriebene oder
+ *                  gelöschte Spielstände belegt als durch gültige, wird die Datei verdichtet.
+ */
+int openSaveStore(struct saveStore *store) {
+    uint8_t header[SAVESTORE_HEADER_SIZE], *index;
+    long end, live;
+    int i;
+
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+    memset(store, 0, sizeof(*store));
+    store->fileHandle = fopen(SAVESTORE_FILE, "r+b");
+
+    if (store->fileHandle == NULL) {
+        store->fileHandle = fopen(SAVESTORE_FILE, "w+b");
+
+        if (store->fileHandle == NULL) {
+            return 0;
+        }
+
+        store->capacity = SAVESTORE_CAPACITY;
+        store->entries = malloc(sizeof(*store->entries) * store->capacity);
+
+        if (store->entries == NULL || !writeHeader(store)) {
+            closeSaveStore(store);
+            return 0;
+        }
+
+        importLegacySlots(store);
+
+        return 1;
+    }
+
+    INSTRUMENT_COUNT(COUNTER_FILE_READS, 2);
+
+    if (fread(header, 1, sizeof(header), store->fileHandle) != sizeof(header) || memcmp(header, "SKST", 4) != 0
+        || header[4] != SAVESTORE_VERSION) {
+        closeSaveStore(store);
+        return 0;
+    }
+
+    store->capacity = (int) readUint32(header + 8);
+    store->count = (int) readUint32(header + 12);
+
+    if (store->capacity < 1 || store->capacity > 1 << 20 || store->count < 0 || store->count > store->capacity) {
+        closeSaveStore(store);
+        return 0;
+    }
+
+    store->entries = malloc(sizeof(*store->entries) * store->capacity);
+    index = malloc((size_t) SAVESTORE_ENTRY_SIZE * (store->count > 0 ? store->count : 1));
+
+    if (store->entries == NULL || index == NULL
+        || fread(index, SAVESTORE_ENTRY_SIZE, (size_t) store->count, store->fileHandle) != (size_t) store->count) {
+        free(index);
+        closeSaveStore(store);
+        return 0;
+    }
+
+    live = 0;
+
+    for (i = 0; i < store->count; i++) {
+        decodeEntry(index + i * SAVESTORE_ENTRY_SIZE, &store->entries[i]);
+        live += (long) store->entries[i].length;
+    }
+
+    free(index);
+
+    // Verdichten schlägt nur fehl, wenn die Datei danach nicht mehr geöffnet werden kann; sonst bleibt sie unverändert
+    if (fseek(store->fileHandle, 0, SEEK_END) == 0 && (end = ftell(store->fileHandle)) >= 0
+        && end - getDataStart(store) - live > live && !compactSaveStore(store)) {
+        return store->fileHandle != NULL;
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        closeSaveStore
+ *
+ * Parameter:       store (struct saveStore *) -> Geöffnete Spielstand-Datei
+ *
+ * Beschreibung:    Schließt die Datei und gibt den Index frei.
+ */
+void closeSaveStore(struct saveStore *store) {
+    if (store->fileHandle != NULL) {
+        fclose(store->fileHandle);
+    }
+
+    free(store->entries);
+    memset(store, 0, sizeof(*store));
+
+    return;
+}
+
+/**
+ * Funktion:        findStoredSave
+ *
+ * Parameter:       store (const struct saveStore *) -> Geöffnete Spielstand-Datei
+ * Parameter:       name (const char *)              -> Name des Spielstands
+ *
+ * Rückgabewert:    Gibt den Index des Spielstands zurück oder -1, wenn es keinen Spielstand mit diesem Namen gibt
+ *
+ * Beschreibung:    Durchsucht den Index im Speicher, ohne auf die Datei zuzugreifen.
+ */
+int findStoredSave(const struct saveStore *store, const char *name) {
+    int i;
+
+    for (i = 0; i < store->count; i++) {
+        if (strncmp(store->entries[i].name, name, SAVESTORE_NAME_LENGTH - 1) == 0) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Funktion:        readStoredSave
+ *
+ * Parameter:       store (struct saveStore *)  -> Geöffnete Spielstand-Datei
+ * Parameter:       index (int)                 -> Index des Spielstands
+ * Parameter:       sudoku (struct savegame *)  -> Enthält nach dem Funktionsaufruf den Spielstand
+ * Parameter:       journal (struct journal *)  -> Enthält nach dem Funktionsaufruf den Zugverlauf (NULL = nicht benötigt)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Spielstand gelesen wurde, andernfalls eine 0 (z.B. Datei beschädigt)
+ *
+ * Beschreibung:    Liest einen Spielstand mit einem Lesezugriff.
+ */
+int readStoredSave(struct saveStore *store, int index, struct savegame *sudoku, struct journal *journal) {
+    uint8_t *buffer;
+    struct saveEntry *entry;
+    int valid;
+
+    if (index < 0 || index >= store->count) {
+        return 0;
+    }
+
+    entry = &store->entries[index];
+
+    if (entry->length > SAVEGAME_JOURNAL_SIZE(JOURNAL_MAX_MOVES) || (buffer = malloc(entry->length)) == NULL) {
+        return 0;
+    }
+
+    INSTRUMENT_BEGIN(TIMER_SAVEGAME_IO);
+    INSTRUMENT_COUNT(COUNTER_FILE_READS, 1);
+
+    valid = fseek(store->fileHandle, (long) entry->offset, SEEK_SET) == 0
+            && fread(buffer, 1, entry->length, store->fileHandle) == entry->length;
+
+    INSTRUMENT_END(TIMER_SAVEGAME_IO);
+
+    valid = valid && decodeSavegame(buffer, entry->length, sudoku, journal);
+    free(buffer);
+
+    return valid;
+}
+
+/**
+ * Funktion:        writeStoredSave
+ *
+ * Parameter:       store (struct saveStore *)        -> Geöffnete Spielstand-Datei
+ * Parameter:       name (const char *)               -> Name des Spielstands (wird auf 39 Zeichen gekürzt)
+ * Parameter:       sudoku (const struct savegame *)  -> Spielstand
+ * Parameter:       journal (const struct journal *)  -> Zugverlauf, der mit gespeichert wird (NULL = ohne Verlauf)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Spielstand gespeichert wurde, andernfalls eine 0 (z.B. Index voll)
+ *
+ * Beschreibung:    Hängt den Spielstand an die Datei an und schreibt danach seinen Eintrag im Index. Ein Spielstand mit
+ *                  gleichem Namen wird überschrieben. Bricht das Programm zwischen den Schreibzugriffen ab, bleibt der
+ *                  bisherige Stand gültig.
+ */
+int writeStoredSave(struct saveStore *store, const char *name, const struct savegame *sudoku, const struct journal *journal) {
+    uint8_t *buffer;
+    struct saveEntry entry;
+    size_t length;
+    long offset;
+    int index, i, j, open, filled, written;
+
+    index = findStoredSave(store, name);
+
+    if (index < 0 && store->count >= store->capacity) {
+        return 0;
+    }
+
+    if ((buffer = malloc(getSavegameSize(journal))) == NULL) {
+        return 0;
+    }
+
+    length = encodeSavegame(sudoku, journal, buffer);
+
+    if ((offset = findFreeSpace(store, length)) < 0) {
+        free(buffer);
+        return 0;
+    }
+
+    written = writeAt(store, offset, buffer, length);
+    free(buffer);
+
+    if (!written) {
+        return 0;
+    }
+
+    // Fortschritt: Anteil der ausgefüllten Felder, die nicht vorgegeben sind
+    open = 0;
+    filled = 0;
+
+    for (i = 0; i < SIZE; i++) {
+        for (j = 0; j < SIZE; j++) {
+            if (sudoku->sudokuGrid.generated[i][j] != 1) {
+                open++;
+                filled += sudoku->sudokuGrid.value[i][j] != 0;
+            }
+        }
+    }
+
+    memset(&entry, 0, sizeof(entry));
+    strncpy(entry.name, name, SAVESTORE_NAME_LENGTH - 1);
+    entry.difficulty = sudoku->difficulty;
+    entry.progress = open > 0 ? filled * 100 / open : 100;
+    entry.pastTime = (uint32_t) (sudoku->pastTime * 1000.0 + 0.5);
+    entry.offset = (uint32_t) offset;
+    entry.length = (uint32_t) length;
+    entry.savedAt = (uint32_t) time(NULL);
+
+    // Der Index im Speicher wird erst angepasst, wenn die Datei geschrieben ist
+    if (index < 0) {
+        if (!writeEntry(store, store->count, &entry)) {
+            return 0;
+        }
+
+        store->count++;
+
+        if (!writeHeader(store)) {
+            store->count--;
+            return 0;
+        }
+
+        store->entries[store->count - 1] = entry;
+
+        return 1;
+    }
+
+    if (!writeEntry(store, index, &entry)) {
+        return 0;
+    }
+
+    store->entries[index] = entry;
+
+    return 1;
+}
+
+/**
+ * Funktion:        deleteStoredSave
+ *
+ * Parameter:       store (struct saveStore *) -> Geöffnete Spielstand-Datei
+ * Parameter:       index (int)                -> Index des Spielstands
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Spielstand gelöscht wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Ersetzt den Eintrag durch den letzten Eintrag des Index und verkürzt den Index um eins. Der Index im
+ *                  Speicher folgt jeweils erst dem erfolgreichen Schreibzugriff. Der Platz des Spielstands wird beim nächsten
+ *                  Speichern wiederverwendet (bzw. beim Verdichten freigegeben).
+ */
+int deleteStoredSave(struct saveStore *store, int index) {
+    int last;
+
+    if (index < 0 || index >= store->count) {
+        return 0;
+    }
+
+    last = store->count - 1;
+
+    if (index < last) {
+        if (!writeEntry(store, index, &store->entries[last])) {
+            return 0;
+        }
+
+        store->entries[index] = store->entries[last];
+    }
+
+    store->count--;
+
+    if (!writeHeader(store)) {
+        store->count++;
+        return 0;
+    }
+
+    return 1;
+}
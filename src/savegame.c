@@ -0,0 +1,438 @@
+#include "../header/sudokuCore.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Funktion:        getCrc32
+ *
+ * Parameter:       data (const void *) -> Daten
+ * Parameter:       length (size_t)     -> Anzahl der Bytes
+ *
+ * Rückgabewert:    Gibt die CRC-32 (Polynom 0xEDB88320, wie zlib) der Daten zurück
+ *
+ * Beschreibung:    Prüfsumme, um beschädigte Spielstände zu erkennen. Für die wenigen Bytes eines Spielstands genügt die
+ *                  bitweise Berechnung ohne Tabelle.
+ */
+uint32_t getCrc32(const void *data, size_t length) {
+    const uint8_t *bytes = data;
+    uint32_t crc;
+    size_t i;
+    int bit;
+
+    crc = 0xFFFFFFFFu;
+
+    for (i = 0; i < length; i++) {
+        crc ^= bytes[i];
+
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+
+    return ~crc;
+}
+
+/**
+ * Funktion:        writeUint32
+ *
+ * Parameter:       buffer (uint8_t *) -> Ziel (4 Bytes)
+ * Parameter:       value (uint32_t)   -> Zahl
+ *
+ * Beschreibung:    Schreibt eine Zahl little-endian, unabhängig von der Plattform.
+ */
+void writeUint32(uint8_t *buffer, uint32_t value) {
+    buffer[0] = (uint8_t) value;
+    buffer[1] = (uint8_t) (value >> 8);
+    buffer[2] = (uint8_t) (value >> 16);
+    buffer[3] = (uint8_t) (value >> 24);
+
+    return;
+}
+
+/**
+ * Funktion:        readUint32
+ *
+ * Parameter:       buffer (const uint8_t *) -> Quelle (4 Bytes)
+ *
+ * Rückgabewert:    Gibt die little-endian gespeicherte Zahl zurück
+ */
+uint32_t readUint32(const uint8_t *buffer) {
+    return (uint32_t) buffer[0] | (uint32_t) buffer[1] << 8 | (uint32_t) buffer[2] << 16 | (uint32_t) buffer[3] << 24;
+}
+
+/**
+ * Funktion:        syncFile
+ *
+ * Parameter:       fileHandle (FILE *) -> Geöffnete Datei
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Daten auf dem Datenträger stehen, andernfalls eine 0
+ *
+ * Beschreibung:    Leert den Puffer der C-Bibliothek und wartet, bis das Betriebssystem die Daten geschrieben hat.
+ */
+int syncFile(FILE *fileHandle) {
+    INSTRUMENT_COUNT(COUNTER_FILE_WRITES, 1);
+
+    if (fflush(fileHandle) != 0) {
+        return 0;
+    }
+
+#ifdef _WIN32
+    return _commit(_fileno(fileHandle)) == 0;
+#else
+    return fsync(fileno(fileHandle)) == 0;
+#endif
+}
+
+/**
+ * Funktion:        replaceFile
+ *
+ * Parameter:       source (const char *) -> Vollständig geschriebene temporäre Datei
+ * Parameter:       target (const char *) -> Datei, die ersetzt wird
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Datei ersetzt wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Ersetzt die Zieldatei in einem Schritt: Nach einem Absturz liegt entweder die alte oder die neue Datei vor.
+ *                  Unter POSIX wird zusätzlich das Verzeichnis synchronisiert, damit die Umbenennung selbst erhalten bleibt.
+ */
+int replaceFile(const char *source, const char *target) {
+#ifdef _WIN32
+    return MoveFileExA(source, target, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    int directory;
+
+    if (rename(source, target) != 0) {
+        return 0;
+    }
+
+    directory = open(".", O_RDONLY);
+
+    if (directory >= 0) {
+        fsync(directory);
+        close(directory);
+    }
+
+    return 1;
+#endif
+}
+
+/**
+ * Funktion:        packCell
+ *
+ * Parameter:       packed (uint8_t *) -> Gepacktes Gitter (vorher mit 0 gefüllt)
+ * Parameter:       cell (int)         -> Index des Feldes
+ * Parameter:       value (int)        -> Wert des Feldes
+ *
+ * Beschreibung:    Legt einen Wert mit SAVEGAME_CELL_BITS Bits ab (bei 9x9 zwei Felder je Byte, unteres Halbbyte zuerst).
+ */
+static void packCell(uint8_t *packed, int cell, int value) {
+    const int perByte = 8 / SAVEGAME_CELL_BITS;
+
+    packed[cell / perByte] |= (uint8_t) ((value & ((1 << SAVEGAME_CELL_BITS) - 1)) << (SAVEGAME_CELL_BITS * (cell % perByte)));
+
+    return;
+}
+
+/**
+ * Funktion:        unpackCell
+ *
+ * Parameter:       packed (const uint8_t *) -> Gepacktes Gitter
+ * Parameter:       cell (int)               -> Index des Feldes
+ *
+ * Rückgabewert:    Gibt den Wert des Feldes zurück
+ */
+static int unpackCell(const uint8_t *packed, int cell) {
+    const int perByte = 8 / SAVEGAME_CELL_BITS;
+
+    return (packed[cell / perByte] >> (SAVEGAME_CELL_BITS * (cell % perByte))) & ((1 << SAVEGAME_CELL_BITS) - 1);
+}
+
+/**
+ * Funktion:        getSavegameSize
+ *
+ * Parameter:       journal (const struct journal *) -> Zugverlauf (NULL = ohne Verlauf)
+ *
+ * Rückgabewert:    Gibt die Anzahl der Bytes zurück, die 'encodeSavegame' schreibt
+ */
+size_t getSavegameSize(const struct journal *journal) {
+    return SAVEGAME_JOURNAL_SIZE(journal != NULL ? journal->count : 0);
+}
+
+/**
+ * Funktion:        encodeSavegame
+ *
+ * Parameter:       sudoku (const struct savegame *)  -> Spielstand
+ * Parameter:       journal (const struct journal *)  -> Zugverlauf (NULL = ohne Verlauf)
+ * Parameter:       buffer (uint8_t *)                -> Enthält nach dem Funktionsaufruf den kodierten Spielstand
+ *                                                       (mindestens 'getSavegameSize(journal)' Bytes)
+ *
+ * Rückgabewert:    Gibt die Anzahl der geschriebenen Bytes zurück
+ *
+ * Beschreibung:    Kodiert einen Spielstand in das Binärformat (siehe savegame.h), damit er mit einem Schreibzugriff
+ *                  gespeichert werden kann. Vom Verlauf werden nur die Änderungen einzelner Felder abgelegt.
+ */
+size_t encodeSavegame(const struct savegame *sudoku, const struct journal *journal, uint8_t *buffer) {
+    const struct move *move;
+    uint8_t *solved, *grid, *given, *moves;
+    double milliseconds;
+    size_t length;
+    int i, row, column, count;
+
+    count = journal != NULL ? journal->count : 0;
+    length = SAVEGAME_JOURNAL_SIZE(count);
+
+    memset(buffer, 0, length);
+    memcpy(buffer, "SKRM", 4);
+    buffer[4] = SAVEGAME_VERSION;
+    buffer[5] = (uint8_t) sudoku->difficulty;
+    buffer[6] = SAVEGAME_GEOMETRY;
+
+    milliseconds = sudoku->pastTime * 1000.0 + 0.5;
+    writeUint32(buffer + 8, milliseconds <= 0 ? 0 : milliseconds >= 4294967295.0 ? 0xFFFFFFFFu : (uint32_t) milliseconds);
+
+    solved = buffer + 12;
+    grid = solved + SAVEGAME_PACKED_GRID;
+    given = grid + SAVEGAME_PACKED_GRID;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        row = i / SIZE;
+        column = i % SIZE;
+        packCell(solved, i, sudoku->sudokuGridSolved.value[row][column]);
+        packCell(grid, i, sudoku->sudokuGrid.value[row][column]);
+
+        if (sudoku->sudokuGrid.generated[row][column] == 1) {
+            given[i / 8] |= (uint8_t) (1 << (i % 8));
+        }
+    }
+
+    writeUint32(buffer + SAVEGAME_BOARD_END, (uint32_t) count);
+    writeUint32(buffer + SAVEGAME_BOARD_END + 4, (uint32_t) (journal != NULL ? journal->position : 0));
+    moves = buffer + SAVEGAME_BOARD_END + 8;
+
+    for (i = 0; i < count; i++, moves += SAVEGAME_MOVE_SIZE) {
+        move = getJournalMove(journal, i);
+        moves[0] = (uint8_t) move->cell;
+        moves[1] = (uint8_t) (move->cell >> 8);
+        moves[2] = move->oldValue;
+        moves[3] = move->newValue;
+        writeUint32(moves + 4, move->time);
+    }
+
+    writeUint32(buffer + length - 4, getCrc32(buffer, length - 4));
+
+    return length;
+}
+
+/**
+ * Funktion:        decodeJournal
+ *
+ * Parameter:       buffer (const uint8_t *)    -> Spielstand ab Version 2 mit geprüfter Länge
+ * Parameter:       journal (struct journal *)  -> Enthält nach dem Funktionsaufruf den Zugverlauf
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Verlauf gültig ist, andernfalls eine 0
+ */
+static int decodeJournal(const uint8_t *buffer, struct journal *journal) {
+    const uint8_t *moves;
+    uint32_t position, dropped;
+    int i, count, cell;
+
+    count = (int) readUint32(buffer + SAVEGAME_BOARD_END);
+    moves = buffer + SAVEGAME_BOARD_END + 8;
+
+    for (i = 0; i < count; i++, moves += SAVEGAME_MOVE_SIZE) {
+        cell = moves[0] | moves[1] << 8;
+
+        if (cell >= GRID_CELLS || moves[2] > SIZE || moves[3] > SIZE || moves[2] == moves[3]
+            || !recordMove(journal, cell, moves[2], moves[3], readUint32(moves + 4))) {
+            freeJournal(journal);
+            return 0;
+        }
+    }
+
+    // Rückgängig gemachte Züge bleiben für 'redoMove' erhalten. Konnte der Verlauf nicht wachsen, hat 'recordMove' die
+    // ältesten Züge verworfen: Die Position rückt um diese Züge nach vorne und wird auf das Ende des Verlaufs begrenzt,
+    // sonst greifen 'undoMove' und 'redoMove' dahinter.
+    position = readUint32(buffer + SAVEGAME_BOARD_END + 4);
+    dropped = (uint32_t) (count - journal->count);
+    position = position > dropped ? position - dropped : 0;
+    journal->position = position > (uint32_t) journal->count ? journal->count : (int) position;
+
+    return 1;
+}
+
+/**
+ * Funktion:        decodeBinarySavegame
+ *
+ * Parameter:       buffer (const uint8_t *)    -> Gelesene Bytes
+ * Parameter:       length (size_t)             -> Anzahl der gelesenen Bytes
+ * Parameter:       sudoku (struct savegame *)  -> Enthält nach dem Funktionsaufruf den Spielstand
+ * Parameter:       journal (struct journal *)  -> Enthält nach dem Funktionsaufruf den Zugverlauf (NULL = Verlauf überspringen)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Spielstand gültig ist, andernfalls eine 0
+ *
+ * Beschreibung:    Dekodiert das Binärformat und prüft Version, Blockgröße, Länge, Prüfsumme und Wertebereich.
+ */
+static int decodeBinarySavegame(const uint8_t *buffer, size_t length, struct savegame *sudoku, struct journal *journal) {
+    const uint8_t *solved, *grid, *given;
+    uint32_t count;
+    int i, row, column, solvedValue, value;
+
+    if (length < SAVEGAME_V1_SIZE || buffer[6] != SAVEGAME_GEOMETRY) {
+        return 0;
+    }
+
+    if (buffer[4] == 1) {
+        if (length != SAVEGAME_V1_SIZE) {
+            return 0;
+        }
+    } else if (buffer[4] == SAVEGAME_VERSION && length >= SAVEGAME_SIZE) {
+        count = readUint32(buffer + SAVEGAME_BOARD_END);
+
+        if (count > JOURNAL_MAX_MOVES || length != SAVEGAME_JOURNAL_SIZE(count)
+            || readUint32(buffer + SAVEGAME_BOARD_END + 4) > count) {
+            return 0;
+        }
+    } else {
+        return 0;
+    }
+
+    if (readUint32(buffer + length - 4) != getCrc32(buffer, length - 4)) {
+        return 0;
+    }
+
+    solved = buffer + 12;
+    grid = solved + SAVEGAME_PACKED_GRID;
+    given = grid + SAVEGAME_PACKED_GRID;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        row = i / SIZE;
+        column = i % SIZE;
+        solvedValue = unpackCell(solved, i);
+        value = unpackCell(grid, i);
+
+        if (solvedValue > SIZE || value > SIZE) {
+            return 0;
+        }
+
+        sudoku->sudokuGridSolved.value[row][column] = solvedValue;
+        sudoku->sudokuGridSolved.generated[row][column] = 1;
+        sudoku->sudokuGrid.value[row][column] = value;
+        sudoku->sudokuGrid.generated[row][column] = (given[i / 8] >> (i % 8)) & 1;
+    }
+
+    sudoku->pastTime = (double) readUint32(buffer + 8) / 1000.0;
+    sudoku->difficulty = buffer[5] <= DIFFICULT ? buffer[5] : 0;
+
+    if (journal != NULL && buffer[4] == SAVEGAME_VERSION) {
+        return decodeJournal(buffer, journal);
+    }
+
+    return 1;
+}
+
+#if BOX_SIZE == 3
+
+/**
+ * Funktion:        decodeTextSavegame
+ *
+ * Parameter:       buffer (const uint8_t *)    -> Gelesene Bytes
+ * Parameter:       length (size_t)             -> Anzahl der gelesenen Bytes
+ * Parameter:       sudoku (struct savegame *)  -> Enthält nach dem Funktionsaufruf den Spielstand
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Spielstand gültig ist, andernfalls eine 0
+ *
+ * Beschreibung:    Liest das alte Textformat: je Feld vier Ziffern (Lösung, Wert, Lösung vorgegeben, Wert vorgegeben),
+ *                  danach ein Zeilenumbruch und die Zeit in Sekunden. Der Schwierigkeitsgrad wurde nicht gespeichert und wird
+ *                  aus der Anzahl der nicht vorgegebenen Felder abgeleitet.
+ */
+static int decodeTextSavegame(const uint8_t *buffer, size_t length, struct savegame *sudoku) {
+    size_t position;
+    int i, row, column, open;
+
+    if (length < 4 * GRID_CELLS + 1) {
+        return 0;
+    }
+
+    for (i = 0; i < 4 * GRID_CELLS; i++) {
+        if (buffer[i] < '0' || buffer[i] > '9') {
+            return 0;
+        }
+    }
+
+    open = 0;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        row = i / SIZE;
+        column = i % SIZE;
+        sudoku->sudokuGridSolved.value[row][column] = buffer[4 * i] - '0';
+        sudoku->sudokuGrid.value[row][column] = buffer[4 * i + 1] - '0';
+        sudoku->sudokuGridSolved.generated[row][column] = buffer[4 * i + 2] - '0';
+        sudoku->sudokuGrid.generated[row][column] = buffer[4 * i + 3] - '0';
+        open += sudoku->sudokuGrid.generated[row][column] != 1;
+    }
+
+    if (open <= getEmptyFieldsForDifficulty(EASY)) {
+        sudoku->difficulty = EASY;
+    } else if (open <= getEmptyFieldsForDifficulty(MEDIUM)) {
+        sudoku->difficulty = MEDIUM;
+    } else {
+        sudoku->difficulty = DIFFICULT;
+    }
+
+    // Unter Windows wurde der Zeilenumbruch als "\r\n" geschrieben
+    position = 4 * GRID_CELLS;
+
+    if (buffer[position] == '\r') {
+        position++;
+    }
+
+    if (position >= length || buffer[position] != '\n') {
+        return 0;
+    }
+
+    sudoku->pastTime = 0;
+
+    for (position++; position < length && buffer[position] >= '0' && buffer[position] <= '9'; position++) {
+        sudoku->pastTime = sudoku->pastTime * 10 + (buffer[position] - '0');
+    }
+
+    return 1;
+}
+
+#endif
+
+/**
+ * Funktion:        decodeSavegame
+ *
+ * Parameter:       buffer (const uint8_t *)    -> Gelesener Dateiinhalt
+ * Parameter:       length (size_t)             -> Anzahl der gelesenen Bytes
+ * Parameter:       sudoku (struct savegame *)  -> Enthält nach dem Funktionsaufruf den Spielstand
+ * Parameter:       journal (struct journal *)  -> Enthält nach dem Funktionsaufruf den Zugverlauf (NULL = Verlauf überspringen).
+ *                                                 Ein bisheriger Verlauf wird freigegeben, ältere Formate ergeben einen leeren.
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn der Spielstand gültig ist, andernfalls eine 0
+ *
+ * Beschreibung:    Erkennt anhand der Kennung, ob es sich um das Binärformat oder das alte Textformat handelt (nur 9x9).
+ */
+int decodeSavegame(const uint8_t *buffer, size_t length, struct savegame *sudoku, struct journal *journal) {
+    memset(sudoku, 0, sizeof(*sudoku));
+
+    if (journal != NULL) {
+        freeJournal(journal);
+    }
+
+    if (length >= 4 && memcmp(buffer, "SKRM", 4) == 0) {
+        return decodeBinarySavegame(buffer, length, sudoku, journal);
+    }
+
+#if BOX_SIZE == 3
+    return decodeTextSavegame(buffer, length, sudoku);
+#else
+    return 0;
+#endif
+}
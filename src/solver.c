@@ -0,0 +1,725 @@
+#include "../header/sudokuCore.h"
+
+// Interner Zustand des Lösers. Wird einmal angelegt und während der Suche nur über den Trail zurückgesetzt, nie kopiert.
+struct solverState {
+    unsigned char value[GRID_CELLS];    // Aktuelle Werte (0 = leer)
+    digitMask rowMask[SIZE];            // Bereits gesetzte Ziffern je Zeile
+    digitMask columnMask[SIZE];         // Bereits gesetzte Ziffern je Spalte
+    digitMask boxMask[SIZE];            // Bereits gesetzte Ziffern je Block
+    cellIndex empty[GRID_CELLS];        // Liste der leeren Felder
+    cellIndex emptyIndex[GRID_CELLS];   // Position eines leeren Feldes in 'empty'
+    int emptyCount;
+    cellIndex trail[GRID_CELLS];        // Reihenfolge, in der Felder gesetzt wurden (für das Zurücksetzen)
+    int trailSize;
+    int solutions;                      // Anzahl bislang gefundener Lösungen
+    int limit;                          // Suche abbrechen, sobald so viele Lösungen gefunden wurden
+    long budget;                        // Verbleibende Verzweigungen (negativ = unbegrenzt, 0 = Suche abgebrochen)
+    unsigned char solution[GRID_CELLS]; // Erste gefundene Lösung
+    const unsigned char *prefer;        // Bekannte Lösung, deren Ziffer bei jeder Verzweigung zuerst probiert wird (NULL = keine)
+};
+
+/**
+ * Funktion:        countDigits
+ *
+ * Parameter:       mask (digitMask) -> Bitmaske von Ziffern
+ *
+ * Rückgabewert:    Gibt die Anzahl der gesetzten Bits zurück
+ *
+ * Beschreibung:    Zählt die Ziffern in einer Bitmaske ohne Bibliotheksaufruf.
+ */
+static int countDigits(digitMask mask) {
+#if SIZE <= 16
+    mask = mask - ((mask >> 1) & 0x5555);
+    mask = (mask & 0x3333) + ((mask >> 2) & 0x3333);
+    mask = (mask + (mask >> 4)) & 0x0F0F;
+
+    return (mask + (mask >> 8)) & 0x1F;
+#else
+    mask = mask - ((mask >> 1) & 0x55555555);
+    mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+    mask = (mask + (mask >> 4)) & 0x0F0F0F0F;
+
+    return (int) ((mask * 0x01010101) >> 24);
+#endif
+}
+
+/**
+ * Funktion:        getCandidates
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ * Parameter:       cell (int)                   -> Index des Feldes
+ *
+ * Rückgabewert:    Gibt die Bitmaske der noch möglichen Ziffern zurück
+ *
+ * Beschreibung:    Ermittelt die Kandidaten eines Feldes aus den Zeilen-, Spalten- und Blockmasken.
+ */
+static digitMask getCandidates(const struct solverState *state, int cell) {
+    return ~(state->rowMask[rowOf[cell]] | state->columnMask[columnOf[cell]] | state->boxMask[boxOf[cell]]) & ALL_DIGITS;
+}
+
+/**
+ * Funktion:        placeDigit
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ * Parameter:       cell (int)                   -> Index des Feldes
+ * Parameter:       bit (digitMask)              -> Ziffer als Bitmaske
+ *
+ * Beschreibung:    Setzt eine Ziffer, aktualisiert die Masken und merkt sich das Feld im Trail.
+ */
+static void placeDigit(struct solverState *state, int cell, digitMask bit) {
+    int index, last;
+
+    state->value[cell] = (unsigned char) (__builtin_ctz(bit) + 1);
+    state->rowMask[rowOf[cell]] |= bit;
+    state->columnMask[columnOf[cell]] |= bit;
+    state->boxMask[boxOf[cell]] |= bit;
+
+    // Feld aus der Liste der leeren Felder entfernen (letztes Element nachrücken lassen)
+    index = state->emptyIndex[cell];
+    last = state->empty[--state->emptyCount];
+    state->empty[index] = (cellIndex) last;
+    state->emptyIndex[last] = (cellIndex) index;
+
+    state->trail[state->trailSize++] = (cellIndex) cell;
+
+    return;
+}
+
+/**
+ * Funktion:        undoTo
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ * Parameter:       mark (int)                   -> Trail-Größe, auf die zurückgesetzt werden soll
+ *
+ * Beschreibung:    Nimmt alle seit 'mark' gesetzten Ziffern wieder zurück.
+ */
+static void undoTo(struct solverState *state, int mark) {
+    int cell;
+    digitMask bit;
+
+    while (state->trailSize > mark) {
+        cell = state->trail[--state->trailSize];
+        bit = (digitMask) ((digitMask) 1 << (state->value[cell] - 1));
+
+        state->value[cell] = 0;
+        state->rowMask[rowOf[cell]] &= ~bit;
+        state->columnMask[columnOf[cell]] &= ~bit;
+        state->boxMask[boxOf[cell]] &= ~bit;
+
+        state->emptyIndex[cell] = (cellIndex) state->emptyCount;
+        state->empty[state->emptyCount++] = (cellIndex) cell;
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        propagateHiddenSingles
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ * Parameter:       *changed (int)               -> Wird auf 1 gesetzt, wenn eine Ziffer gesetzt wurde
+ *
+ * Rückgabewert:    Gibt eine 0 bei einem Widerspruch zurück, andernfalls eine 1
+ *
+ * Beschreibung:    Setzt Ziffern, die in einer Einheit nur noch in einem einzigen Feld möglich sind. Die Kandidaten werden
+ *                  einmal für alle leeren Felder bestimmt und nach dem Setzen einer Ziffer nur in deren Einheiten angepasst
+ *                  (statt in jeder der drei Einheiten eines Feldes neu berechnet).
+ */
+static int propagateHiddenSingles(struct solverState *state, int *changed) {
+    int unit, i, j, cell;
+    digitMask candidates[GRID_CELLS], once, twice, placed, hidden, bit;
+    const cellIndex *peers[3];
+
+    memset(candidates, 0, sizeof(candidates));
+
+    for (i = 0; i < state->emptyCount; i++) {
+        candidates[state->empty[i]] = getCandidates(state, state->empty[i]);
+    }
+
+    for (unit = 0; unit < UNITS; unit++) {
+        once = 0;
+        twice = 0;
+        placed = 0;
+
+        for (i = 0; i < SIZE; i++) {
+            cell = unitCells[unit][i];
+
+            if (state->value[cell] != 0) {
+                placed |= (digitMask) ((digitMask) 1 << (state->value[cell] - 1));
+            } else {
+                twice |= once & candidates[cell];
+                once |= candidates[cell];
+            }
+        }
+
+        // Eine Ziffer, die weder gesetzt noch irgendwo möglich ist, macht das Sudoku unlösbar
+        if ((once | placed) != ALL_DIGITS) {
+            return 0;
+        }
+
+        hidden = once & ~twice & ~placed;
+
+        while (hidden != 0) {
+            bit = hidden & -hidden;
+            hidden &= ~bit;
+
+            // Das einzige Feld suchen, in dem die Ziffer noch möglich ist
+            for (i = 0; i < SIZE; i++) {
+                cell = unitCells[unit][i];
+
+                if (state->value[cell] == 0 && (candidates[cell] & bit)) {
+                    break;
+                }
+            }
+
+            // Eine vorherige Ziffer hat das Feld bereits belegt
+            if (i == SIZE) {
+                return 0;
+            }
+
+            placeDigit(state, cell, bit);
+            *changed = 1;
+
+            // Die Ziffer aus den Kandidaten der Zeile, der Spalte und des Blocks streichen
+            candidates[cell] = 0;
+            peers[0] = unitCells[rowOf[cell]];
+            peers[1] = unitCells[SIZE + columnOf[cell]];
+            peers[2] = unitCells[2 * SIZE + boxOf[cell]];
+
+            for (j = 0; j < 3; j++) {
+                for (i = 0; i < SIZE; i++) {
+                    candidates[peers[j][i]] &= ~bit;
+                }
+            }
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        propagate
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ * Parameter:       *bestCell (int)              -> Enthält danach das leere Feld mit den wenigsten Kandidaten (-1 = keines)
+ *
+ * Rückgabewert:    Gibt eine 0 bei einem Widerspruch zurück, andernfalls eine 1
+ *
+ * Beschreibung:    Setzt so lange Naked und Hidden Singles, bis keine Ziffer mehr eindeutig folgt.
+ */
+static int propagate(struct solverState *state, int *bestCell) {
+    int i, cell, count, bestCount, changed;
+    digitMask candidates;
+
+    do {
+        changed = 0;
+        bestCount = SIZE + 1;
+        *bestCell = -1;
+
+        // Naked Singles: Felder mit nur noch einem Kandidaten
+        for (i = 0; i < state->emptyCount; i++) {
+            cell = state->empty[i];
+            candidates = getCandidates(state, cell);
+
+            if (candidates == 0) {
+                return 0;
+            }
+
+            if ((candidates & (candidates - 1)) == 0) {
+                // placeDigit() rückt das letzte leere Feld an Position i nach
+                placeDigit(state, cell, candidates);
+                changed = 1;
+                i--;
+                continue;
+            }
+
+            count = countDigits(candidates);
+
+            if (count < bestCount) {
+                bestCount = count;
+                *bestCell = cell;
+            }
+        }
+
+        if (!changed && state->emptyCount > 0) {
+            if (!propagateHiddenSingles(state, &changed)) {
+                return 0;
+            }
+        }
+    } while (changed);
+
+    return 1;
+}
+
+/**
+ * Funktion:        search
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ *
+ * Beschreibung:    Backtracking-Suche mit Propagation. Verzweigt am Feld mit den wenigsten Kandidaten (MRV), mit der Ziffer
+ *                  aus 'prefer' zuerst.
+ */
+static void search(struct solverState *state) {
+    int mark, branchMark, cell;
+    digitMask candidates, first, bit;
+
+    mark = state->trailSize;
+
+    if (!propagate(state, &cell)) {
+        undoTo(state, mark);
+        return;
+    }
+
+    if (state->emptyCount == 0) {
+        // Lösung gefunden, die erste wird gespeichert
+        if (state->solutions == 0) {
+            memcpy(state->solution, state->value, GRID_CELLS);
+        }
+
+        state->solutions++;
+        undoTo(state, mark);
+        return;
+    }
+
+    candidates = getCandidates(state, cell);
+    first = state->prefer != NULL ? candidates & (digitMask) ((digitMask) 1 << (state->prefer[cell] - 1)) : 0;
+
+    while (candidates != 0 && state->solutions < state->limit && state->budget != 0) {
+        bit = first != 0 ? first : candidates & -candidates;
+        first = 0;
+        candidates &= ~bit;
+        state->budget--;
+
+        branchMark = state->trailSize;
+        placeDigit(state, cell, bit);
+        search(state);
+        undoTo(state, branchMark);
+    }
+
+    undoTo(state, mark);
+
+    return;
+}
+
+/**
+ * Funktion:        initSolverState
+ *
+ * Parameter:       state (struct solverState *)          -> Zustand, der initialisiert wird
+ * Parameter:       grid (const unsigned char[GRID_CELLS])        -> Flaches Sudoku-Gitter (0 = leer)
+ * Parameter:       limit (int)                           -> Maximale Anzahl zu suchender Lösungen
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn das Gitter ungültige Werte oder Widersprüche enthält, andernfalls eine 1
+ *
+ * Beschreibung:    Überträgt ein Gitter in den Zustand des Lösers.
+ */
+static int initSolverState(struct solverState *state, const unsigned char grid[GRID_CELLS], int limit) {
+    int cell;
+    digitMask bit;
+
+    memset(state, 0, sizeof(*state));
+    state->limit = limit;
+    state->budget = -1;
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        state->emptyIndex[cell] = (cellIndex) state->emptyCount;
+        state->empty[state->emptyCount++] = (cellIndex) cell;
+    }
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        if (grid[cell] == 0) {
+            continue;
+        }
+
+        if (grid[cell] > SIZE) {
+            return 0;
+        }
+
+        bit = (digitMask) ((digitMask) 1 << (grid[cell] - 1));
+
+        // Vorgegebene Ziffer widerspricht einer anderen Vorgabe
+        if (!(getCandidates(state, cell) & bit)) {
+            return 0;
+        }
+
+        placeDigit(state, cell, bit);
+    }
+
+    // Vorgaben gehören nicht zum Trail und werden nie zurückgenommen
+    state->trailSize = 0;
+
+    return 1;
+}
+
+/**
+ * Funktion:        solveGrid
+ *
+ * Parameter:       grid (const unsigned char[GRID_CELLS])     -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ * Parameter:       solution (unsigned char[GRID_CELLS])       -> Enthält nach dem Funktionsaufruf die Lösung (nur bei Rückgabewert 1)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn eine Lösung gefunden wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Löst ein beliebiges, teilweise ausgefülltes Sudoku.
+ */
+int solveGrid(const unsigned char grid[GRID_CELLS], unsigned char solution[GRID_CELLS]) {
+    struct solverState state;
+
+    INSTRUMENT_COUNT(COUNTER_SOLVER_CALLS, 1);
+
+    if (!initSolverState(&state, grid, 1)) {
+        return 0;
+    }
+
+    search(&state);
+
+    if (state.solutions == 0) {
+        return 0;
+    }
+
+    memcpy(solution, state.solution, GRID_CELLS);
+
+    return 1;
+}
+
+/**
+ * Funktion:        countGridSolutions
+ *
+ * Parameter:       grid (const unsigned char[GRID_CELLS]) -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ * Parameter:       limit (int)                    -> Zählung beenden, sobald so viele Lösungen gefunden wurden
+ *
+ * Rückgabewert:    Gibt die Anzahl der Lösungen zurück (höchstens 'limit')
+ *
+ * Beschreibung:    Zählt die Lösungen eines Sudokus. Mit limit = 2 lässt sich schnell prüfen, ob ein Sudoku eindeutig lösbar ist.
+ */
+int countGridSolutions(const unsigned char grid[GRID_CELLS], int limit) {
+    struct solverState state;
+
+    INSTRUMENT_COUNT(COUNTER_UNIQUENESS_CHECKS, 1);
+
+    if (limit < 1 || !initSolverState(&state, grid, limit)) {
+        return 0;
+    }
+
+    search(&state);
+
+    return state.solutions;
+}
+
+/**
+ * Funktion:        solveGridUnique
+ *
+ * Parameter:       grid (const unsigned char[GRID_CELLS]) -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ * Parameter:       solution (unsigned char[GRID_CELLS])   -> Enthält nach dem Funktionsaufruf die erste gefundene Lösung
+ *
+ * Rückgabewert:    Gibt die Anzahl der Lösungen zurück (0, 1 oder 2 = mehrere)
+ *
+ * Beschreibung:    Löst ein Sudoku und prüft in derselben Suche, ob die Lösung eindeutig ist (statt 'solveGrid' und danach
+ *                  'countGridSolutions').
+ */
+int solveGridUnique(const unsigned char grid[GRID_CELLS], unsigned char solution[GRID_CELLS]) {
+    struct solverState state;
+
+    INSTRUMENT_COUNT(COUNTER_SOLVER_CALLS, 1);
+
+    if (!initSolverState(&state, grid, 2)) {
+        return 0;
+    }
+
+    search(&state);
+
+    if (state.solutions > 0) {
+        memcpy(solution, state.solution, GRID_CELLS);
+    }
+
+    return state.solutions;
+}
+
+/**
+ * Funktion:        countGridSolutionsWithin
+ *
+ * Parameter:       grid (const unsigned char[GRID_CELLS]) -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ * Parameter:       limit (int)                            -> Zählung beenden, sobald so viele Lösungen gefunden wurden
+ * Parameter:       budget (long)                          -> Höchstzahl an Verzweigungen der Suche
+ *
+ * Rückgabewert:    Gibt die Anzahl der Lösungen zurück (höchstens 'limit') oder -1, wenn das Budget nicht gereicht hat
+ *
+ * Beschreibung:    Wie 'countGridSolutions', aber mit begrenzter Laufzeit. Ab 16x16 brauchen einzelne Eindeutigkeitsprüfungen
+ *                  beim Ausdünnen sonst Millionen Verzweigungen; der Aufrufer behandelt sie als nicht eindeutig.
+ */
+int countGridSolutionsWithin(const unsigned char grid[GRID_CELLS], int limit, long budget) {
+    struct solverState state;
+
+    INSTRUMENT_COUNT(COUNTER_UNIQUENESS_CHECKS, 1);
+
+    if (limit < 1 || !initSolverState(&state, grid, limit)) {
+        return 0;
+    }
+
+    state.budget = budget;
+    search(&state);
+
+    return state.budget == 0 && state.solutions < limit ? -1 : state.solutions;
+}
+
+/**
+ * Funktion:        hasOtherSolutionWithin
+ *
+ * Parameter:       grid (const unsigned char[GRID_CELLS])     -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer), 'cell' ist leer
+ * Parameter:       solution (const unsigned char[GRID_CELLS]) -> Bekannte Lösung des Gitters
+ * Parameter:       cell (int)                                 -> Gerade geleertes Feld
+ * Parameter:       budget (long)                              -> Höchstzahl an Verzweigungen der Suche
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn es eine Lösung mit einer anderen Ziffer in 'cell' gibt, eine 0, wenn nicht, und -1,
+ *                  wenn das Budget nicht gereicht hat
+ *
+ * Beschreibung:    Eindeutigkeitsprüfung beim Ausdünnen, wenn die Lösung bekannt ist: Statt bis zu zwei Lösungen zu zählen, wird nur
+ *                  nach einer Lösung ohne die bekannte Ziffer in 'cell' gesucht. Eine solche Lösung weicht meist nur in wenigen
+ *                  Feldern ab, daher wird überall sonst die bekannte Ziffer zuerst probiert.
+ */
+int hasOtherSolutionWithin(const unsigned char grid[GRID_CELLS], const unsigned char solution[GRID_CELLS], int cell, long budget) {
+    struct solverState state;
+    digitMask candidates, bit;
+
+    INSTRUMENT_COUNT(COUNTER_UNIQUENESS_CHECKS, 1);
+
+    if (!initSolverState(&state, grid, 1)) {
+        return 0;
+    }
+
+    state.budget = budget;
+    state.prefer = solution;
+    candidates = getCandidates(&state, cell) & (digitMask) ~((digitMask) 1 << (solution[cell] - 1));
+
+    while (candidates != 0 && state.solutions == 0 && state.budget != 0) {
+        bit = candidates & -candidates;
+        candidates &= ~bit;
+        state.budget--;
+
+        placeDigit(&state, cell, bit);
+        search(&state);
+        undoTo(&state, 0);
+    }
+
+    return state.budget == 0 && state.solutions == 0 ? -1 : state.solutions;
+}
+
+/**
+ * Funktion:        solveSudoku
+ *
+ * Parameter:       sudokuGrid (const struct sudoku *) -> Sudoku, welches gelöst werden soll
+ * Parameter:       solution (struct sudoku *)         -> Enthält nach dem Funktionsaufruf das gelöste Sudoku (alle Felder vordefiniert)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn eine Lösung gefunden wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Löst ein Sudoku in der Struktur 'sudoku'. Die Lösung hat dieselbe Form wie ein Rückgabewert von 'generateFullSudoku'.
+ */
+int solveSudoku(const struct sudoku *sudokuGrid, struct sudoku *solution) {
+    unsigned char grid[GRID_CELLS], solved[GRID_CELLS];
+    int i, j;
+
+    for (i = 0; i < SIZE; i++) {
+        for (j = 0; j < SIZE; j++) {
+            if (sudokuGrid->value[i][j] < 0 || sudokuGrid->value[i][j] > SIZE) {
+                return 0;
+            }
+
+            grid[i * SIZE + j] = (unsigned char) sudokuGrid->value[i][j];
+        }
+    }
+
+    if (!solveGrid(grid, solved)) {
+        return 0;
+    }
+
+    for (i = 0; i < SIZE; i++) {
+        for (j = 0; j < SIZE; j++) {
+            solution->value[i][j] = solved[i * SIZE + j];
+            solution->generated[i][j] = 1;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        pickRandomDigit
+ *
+ * Parameter:       candidates (digitMask)   -> Bitmaske der verbleibenden Kandidaten (nicht 0)
+ * Parameter:       random (struct random *) -> Zufallsgenerator
+ *
+ * Rückgabewert:    Gibt einen zufälligen der Kandidaten als Bitmaske zurück
+ */
+static digitMask pickRandomDigit(digitMask candidates, struct random *random) {
+    digitMask higher, bit;
+    int skip;
+
+    bit = candidates & -candidates;
+
+    for (skip = getRandomBelow(random, countDigits(candidates)); skip > 0; skip--) {
+        higher = candidates & ~((bit << 1) - 1);
+        bit = higher & -higher;
+    }
+
+    return bit;
+}
+
+#if BOX_SIZE == 3
+
+/**
+ * Funktion:        fillRandom
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ * Parameter:       random (struct random *)     -> Zufallsgenerator
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn alle Felder gefüllt wurden, andernfalls eine 0 (Zustand unverändert)
+ *
+ * Beschreibung:    Zufällige Tiefensuche zum Füllen eines Gitters. Verzweigt am Feld mit den wenigsten Kandidaten (MRV) und
+ *                  probiert dessen Kandidaten in zufälliger Reihenfolge. Anders als 'search' ohne Hidden Singles, da beim
+ *                  Füllen kaum zurückgesetzt werden muss und der Durchlauf über alle Einheiten mehr kostet als er spart.
+ */
+static int fillRandom(struct solverState *state, struct random *random) {
+    int i, cell, bestCell, count, bestCount;
+    digitMask candidates, bit;
+
+    if (state->emptyCount == 0) {
+        return 1;
+    }
+
+    bestCell = -1;
+    bestCount = SIZE + 1;
+
+    for (i = 0; i < state->emptyCount && bestCount > 1; i++) {
+        cell = state->empty[i];
+        count = countDigits(getCandidates(state, cell));
+
+        if (count == 0) {
+            return 0;
+        }
+
+        if (count < bestCount) {
+            bestCount = count;
+            bestCell = cell;
+        }
+    }
+
+    candidates = getCandidates(state, bestCell);
+
+    while (candidates != 0) {
+        bit = pickRandomDigit(candidates, random);
+        candidates &= ~bit;
+        placeDigit(state, bestCell, bit);
+
+        if (fillRandom(state, random)) {
+            return 1;
+        }
+
+        undoTo(state, state->trailSize - 1);
+    }
+
+    return 0;
+}
+
+#else
+
+// Verzweigungen je Versuch, ein Gitter zu füllen, bevor neu begonnen wird
+#define GENERATE_BRANCH_BUDGET (4L * GRID_CELLS)
+
+/**
+ * Funktion:        fillRandom
+ *
+ * Parameter:       state (struct solverState *) -> Zustand des Lösers
+ * Parameter:       random (struct random *)     -> Zufallsgenerator
+ * Parameter:       *budget (long)               -> Verbleibende Verzweigungen, wird heruntergezählt
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn alle Felder gefüllt wurden, andernfalls eine 0 (Zustand unverändert)
+ *
+ * Beschreibung:    Variante für Gitter ab 16x16 und 4x4: Ohne Hidden Singles läuft die Suche dort oft sehr lange in
+ *                  Sackgassen, daher wird vor jeder Verzweigung vollständig propagiert. Ist das Budget aufgebraucht,
+ *                  bricht die Suche ab und 'generateGrid' beginnt neu (schwere Ausreißer kosten so nur begrenzt Zeit).
+ */
+static int fillRandom(struct solverState *state, struct random *random, long *budget) {
+    int mark, branchMark, cell;
+    digitMask candidates, bit;
+
+    mark = state->trailSize;
+
+    if (!propagate(state, &cell)) {
+        undoTo(state, mark);
+        return 0;
+    }
+
+    if (state->emptyCount == 0) {
+        return 1;
+    }
+
+    candidates = getCandidates(state, cell);
+    branchMark = state->trailSize;
+
+    while (candidates != 0 && --*budget > 0) {
+        bit = pickRandomDigit(candidates, random);
+        candidates &= ~bit;
+        placeDigit(state, cell, bit);
+
+        if (fillRandom(state, random, budget)) {
+            return 1;
+        }
+
+        undoTo(state, branchMark);
+    }
+
+    undoTo(state, mark);
+
+    return 0;
+}
+
+#endif
+
+/**
+ * Funktion:        generateGrid
+ *
+ * Parameter:       random (struct random *)         -> Zufallsgenerator
+ * Parameter:       grid (unsigned char[GRID_CELLS]) -> Enthält nach dem Funktionsaufruf ein zufälliges, vollständig gelöstes Gitter
+ *
+ * Beschreibung:    Erzeugt ein vollständiges Sudoku durch zufällige Tiefensuche über die Bitmasken des Lösers. Bei 9x9 sind
+ *                  die drei Blöcke auf der Diagonalen voneinander unabhängig und werden direkt mit zufälligen Permutationen
+ *                  gefüllt (bei anderen Größen lassen sie sich nicht immer ergänzen, dort nur der erste Block), der Rest wird
+ *                  mit zufälliger Kandidatenreihenfolge gesucht (siehe 'fillRandom'). Im Gegensatz zum Grundmuster mit
+ *                  Symmetrietransformation ist so jedes gültige Gitter erreichbar (nicht exakt gleichverteilt).
+ */
+void generateGrid(struct random *random, unsigned char grid[GRID_CELLS]) {
+    struct solverState state;
+    unsigned char empty[GRID_CELLS];
+    int digits[SIZE], box, i, cell;
+#if BOX_SIZE != 3
+    long budget;
+#endif
+
+    memset(empty, 0, sizeof(empty));
+
+    do {
+        initSolverState(&state, empty, 1);
+
+        for (box = 0; box < (BOX_SIZE == 3 ? SIZE : 1); box += BOX_SIZE + 1) {
+            for (i = 0; i < SIZE; i++) {
+                digits[i] = i;
+            }
+
+            shuffle(digits, SIZE, random);
+
+            for (i = 0; i < SIZE; i++) {
+                cell = unitCells[2 * SIZE + box][i];
+                placeDigit(&state, cell, (digitMask) ((digitMask) 1 << digits[i]));
+            }
+        }
+
+        state.trailSize = 0;
+#if BOX_SIZE == 3
+    } while (!fillRandom(&state, random));
+#else
+        budget = GENERATE_BRANCH_BUDGET;
+    } while (!fillRandom(&state, random, &budget));
+#endif
+
+    memcpy(grid, state.value, GRID_CELLS);
+
+    return;
+}
@@ -0,0 +1,178 @@
+#include "../header/sudokuCore.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/**
+ * Funktion:        getMonotonicTime
+ *
+ * Rückgabewert:    Gibt einen monotonen Zeitstempel in Nanosekunden zurück
+ *
+ * Beschreibung:    Zeitquelle für Laufzeitmessungen. Im Gegensatz zu time() unabhängig von Änderungen der Systemuhr.
+ */
+uint64_t getMonotonicTime() {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+
+    QueryPerformanceCounter(&counter);
+
+    return (uint64_t) (counter.QuadPart / frequency.QuadPart) * 1000000000ULL
+         + (uint64_t) (counter.QuadPart % frequency.QuadPart) * 1000000000ULL / (uint64_t) frequency.QuadPart;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+#endif
+}
+
+/**
+ * Funktion:        getBucket
+ *
+ * Parameter:       value (uint64_t) -> Laufzeit in Nanosekunden
+ *
+ * Rückgabewert:    Gibt die Stufe des Histogramms zurück
+ *
+ * Beschreibung:    Werte unter 16 erhalten eine eigene Stufe, darüber wird jede Zweierpotenz in 16 gleich breite Stufen geteilt.
+ */
+static int getBucket(uint64_t value) {
+    int exponent;
+
+    if (value < 16) {
+        return (int) value;
+    }
+
+    exponent = 63 - __builtin_clzll(value);
+
+    return (exponent - 3) * 16 + (int) ((value >> (exponent - 4)) & 15);
+}
+
+/**
+ * Funktion:        getBucketLimit
+ *
+ * Parameter:       bucket (int) -> Stufe des Histogramms
+ *
+ * Rückgabewert:    Gibt den größten Wert zurück, der in diese Stufe fällt
+ *
+ * Beschreibung:    Umkehrung von 'getBucket' (Obergrenze).
+ */
+static uint64_t getBucketLimit(int bucket) {
+    int exponent;
+
+    if (bucket < 16) {
+        return (uint64_t) bucket;
+    }
+
+    exponent = bucket / 16 + 3;
+
+    return ((uint64_t) (16 + bucket % 16 + 1) << (exponent - 4)) - 1;
+}
+
+/**
+ * Funktion:        initHistogram
+ *
+ * Parameter:       histogram (struct histogram *) -> Histogramm
+ *
+ * Beschreibung:    Leert ein Histogramm.
+ */
+void initHistogram(struct histogram *histogram) {
+    memset(histogram, 0, sizeof(*histogram));
+
+    return;
+}
+
+/**
+ * Funktion:        addToHistogram
+ *
+ * Parameter:       histogram (struct histogram *) -> Histogramm
+ * Parameter:       nanoseconds (uint64_t)         -> Gemessene Laufzeit
+ *
+ * Beschreibung:    Trägt eine Messung ein.
+ */
+void addToHistogram(struct histogram *histogram, uint64_t nanoseconds) {
+    int bucket;
+
+    bucket = getBucket(nanoseconds);
+
+    if (bucket >= HISTOGRAM_BUCKETS) {
+        bucket = HISTOGRAM_BUCKETS - 1;
+    }
+
+    histogram->count[bucket]++;
+    histogram->total++;
+
+    if (nanoseconds > histogram->maximum) {
+        histogram->maximum = nanoseconds;
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        mergeHistogram
+ *
+ * Parameter:       target (struct histogram *)       -> Histogramm, in das addiert wird
+ * Parameter:       source (const struct histogram *) -> Histogramm, das addiert wird
+ *
+ * Beschreibung:    Fasst z.B. die Histogramme mehrerer Threads zusammen.
+ */
+void mergeHistogram(struct histogram *target, const struct histogram *source) {
+    int i;
+
+    for (i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        target->count[i] += source->count[i];
+    }
+
+    target->total += source->total;
+
+    if (source->maximum > target->maximum) {
+        target->maximum = source->maximum;
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        getHistogramPercentile
+ *
+ * Parameter:       histogram (const struct histogram *) -> Histogramm
+ * Parameter:       percentile (double)                  -> Perzentil (0 - 100)
+ *
+ * Rückgabewert:    Gibt die Obergrenze der Stufe zurück, in der das Perzentil liegt (höchstens das Maximum)
+ *
+ * Beschreibung:    Berechnet ein Perzentil der eingetragenen Laufzeiten.
+ */
+uint64_t getHistogramPercentile(const struct histogram *histogram, double percentile) {
+    uint64_t rank, seen, limit;
+    int i;
+
+    if (histogram->total == 0) {
+        return 0;
+    }
+
+    rank = (uint64_t) ceil(percentile / 100.0 * (double) histogram->total);
+
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    seen = 0;
+
+    for (i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += histogram->count[i];
+
+        if (seen >= rank) {
+            limit = getBucketLimit(i);
+            return limit < histogram->maximum ? limit : histogram->maximum;
+        }
+    }
+
+    return histogram->maximum;
+}
@@ -1,32 +1,4 @@
-#include "../header/sudoku.h"
-
-/**
- * Funktion:        checkSavegameSlot
- *
- * Parameter:       slot (int) -> Speicherstand
- *
- * Rückgabewert:    Gibt eine 0 zurück, wenn der Spielstand nicht existiert, andernfalls wird eine 1 zurückgegeben
- *
- * Beschreibung:    Prüft ob Spielstand existiert.
- */
-int checkSavegameSlot(int slot) {
-    // Datei-Handle definieren
-    FILE *fileHandle;
-    char fileName[12] = "slot0.skram\0";
-
-    fileName[4] = (slot - 1) + '0';
-
-    // Prüfen ob Datei existiert
-    fileHandle = fopen(fileName, "r");
-
-    if (fileHandle == NULL) {
-        return 0;
-    }
-
-    fclose(fileHandle);
-
-    return 1;
-}
+#include "../header/sudokuCore.h"
 
 /**
  * Funktion:        readSavegame
@@ -36,233 +8,101 @@ int checkSavegameSlot(int slot) {
  *
  * Rückgabewert:    Gibt die Struktur 'savegame' zurück
  *
- * Beschreibung:    Liest ein gespeichertes Spiel aus einer Datei (Slot) und gibt es als Struktur 'savegame' zurück.
+ * Beschreibung:    Liest ein gespeichertes Spiel mit einem Lesezugriff aus einer alten Slot-Datei und gibt es als Struktur 'savegame' zurück.
+ *                  Binärformat und altes Textformat werden automatisch erkannt. Wird nur noch benötigt, um die alten Slots in die
+ *                  Spielstand-Datei zu übernehmen (siehe saveStore.c).
  */
 struct savegame readSavegame(int slot, int *error) {
     struct savegame sudoku;
-    int temp, i, j, n;
+    uint8_t buffer[SAVEGAME_MAX_SIZE];
+    size_t length;
     // Datei-Handle definieren
     FILE *fileHandle;
     char fileName[12] = "slot0.skram\0";
 
     *error = 0;
     fileName[4] = (slot - 1) + '0';
-    i = 0;
-    j = 0;
-    n = 0;
-    sudoku.pastTime = 0;
+    memset(&sudoku, 0, sizeof(sudoku));
 
-    fileHandle = fopen(fileName, "r");
+    INSTRUMENT_BEGIN(TIMER_SAVEGAME_IO);
+    INSTRUMENT_COUNT(COUNTER_FILE_OPENS, 1);
+    fileHandle = fopen(fileName, "rb");
+    length = 0;
 
     if (fileHandle == NULL) {
         *error = 1;
-        return sudoku;
-    }
-
-    // Jedes Zeichen (Zahl) einzeln auslesen und in die Struktur zusammensetzen
-    while (fscanf(fileHandle, "%1d", &temp) != EOF) {
-        if (i < 10) {
-            switch (n) {
-                case 0:
-                    sudoku.sudokuGridSolved.value[i][j] = temp;
-                    break;
-
-                case 1:
-                    sudoku.sudokuGrid.value[i][j] = temp;
-                    break;
-
-                case 2:
-                    sudoku.sudokuGridSolved.generated[i][j] = temp;
-                    break;
-
-                case 3:
-                    sudoku.sudokuGrid.generated[i][j] = temp;
-                    break;
-            }
-
-            n++;
-
-            // Sobald 4 Ziffern ausgelesen wurden wird in die nächste Spalte gewechselt
-            if (n > 3) {
-                n = 0;
-                j++;
-            }
-
-            // Sobald 9 Spalten ausgelesen wurden, wird in die nächste Zeile gewechselt
-            if (j == 9) {
-                j = 0;
-                i++;
-            }
-        }
+    } else {
+        length = fread(buffer, 1, sizeof(buffer), fileHandle);
+        fclose(fileHandle);
+        INSTRUMENT_COUNT(COUNTER_FILE_READS, 1);
     }
 
-    // Dateizeiger auf Dateianfang zurücksetzen
-    fseek(fileHandle, 0, SEEK_SET);
-
-    // Datei erneut bis Zeilenumbruch durchlaufen
-    while ((temp = fgetc(fileHandle)) != EOF) {
-        if (temp == '\n') {
-            break;
-        }
-    }
+    INSTRUMENT_END(TIMER_SAVEGAME_IO);
 
-    if (temp == EOF) {
+    if (*error == 0 && !decodeSavegame(buffer, length, &sudoku, NULL)) {
         *error = 2;
-        return sudoku;
     }
 
-    // Nach Zeilenumbruch erneut jedes Zeichen (Zahl) einzeln auslesen und auf dem mit 10 multiplizierten Zeitwert der Struktur aufaddieren
-    while (fscanf(fileHandle, "%1d", &temp) != EOF) {
-        sudoku.pastTime *= 10;
-        sudoku.pastTime += (double) temp;
-    }
-
-    fclose(fileHandle);
-
     return sudoku;
 }
 
-/**
- * Funktion:        writeSavegame
- *
- * Parameter:       sudoku (struct savegame) -> Savegame-Struktur, in dem der aktuelle Spielfortschritt, die Lösung und die bislang benötigte Zeit enthalten ist
- * Parameter:       slot (int)               -> Speicherstand
- *
- * Rückgabewert:    Gibt eine 0 für falsch und eine 1 für korrekt zurück
- *
- * Beschreibung:    Speichert den aktuellen Spielfortschritt in einer Datei (Slot).
- */
-int writeSavegame(struct savegame sudoku, int slot) {
-    int i, j;
-    // Datei-Handle definieren
-    FILE *fileHandle;
-    char fileName[12] = "slot0.skram\0";
-
-    fileName[4] = (slot - 1) + '0';
-
-    fileHandle = fopen(fileName, "w");
-
-    if (fileHandle == NULL) {
-        return 0;
-    }
-
-    // Sudoku Strukturen zerlegen und in Datei schreiben
-    for (i = 0; i < SIZE; i++) {
-        for (j = 0; j < SIZE; j++) {
-            fprintf(fileHandle, "%d", sudoku.sudokuGridSolved.value[i][j]);
-            fprintf(fileHandle, "%d", sudoku.sudokuGrid.value[i][j]);
-            fprintf(fileHandle, "%d", sudoku.sudokuGridSolved.generated[i][j]);
-            fprintf(fileHandle, "%d", sudoku.sudokuGrid.generated[i][j]);
-        }
-    }
-
-    // Zeilenumbruch und Zeitwert in Datei schreiben
-    fprintf(fileHandle, "\n%.0f", sudoku.pastTime);
-
-    fclose(fileHandle);
-
-    return 1;
-}
-
-/**
- * Funktion:        deleteSavegame
- *
- * Parameter:       slot (int) -> Speicherstand
- *
- * Beschreibung:    Löscht einen Speicherstand (Slot) -> Löscht die Datei.
- */
-void deleteSavegame(int slot) {
-	char fileName[12] = "slot0.skram\0";
-    fileName[4] = (slot - 1) + '0';
-
-	if (unlink(fileName) < 0) {
-		// Darf nicht auftreten
-		die();
-	}
-
-	return;
-}
-
 /**
  * Funktion:        init
  *
+ * Parameter:       seed (uint64_t) -> Startwert für den Zufallsgenerator (gleicher Startwert = gleiche Sudokus)
+ *
  * Beschreibung:    Initialisiert das Programm.
  */
-void init() {
-    srand((unsigned)time(NULL));
+void init(uint64_t seed) {
+    seedRandom(getSessionRandom(), seed);
 
     return;
 }
 
-/**
- * Funktion:        die
- *
- * Beschreibung:    Terminiert das Programm bei einem unerwarteten Fehler.
- */
-void die() {
-    system("cls");
-    printf("Es ist ein unerwarteter Fehler aufgetreten! Bitte starten Sie das Programm neu!\n");
-    exit(0);
-    return;
-}
-
 /**
  * Funktion:        generateFullSudoku
  *
+ * Parameter:       random (struct random *) -> Zufallsgenerator
+ * Parameter:       generator (int)          -> GENERATOR_PATTERN oder GENERATOR_BACKTRACK
+ *
  * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
  *
  * Beschreibung:    Generiert ein vollständiges Sudoku in einem zeidimensionalem numerischem Array innerhalb der Struktur 'sudoku'.
+ *                  GENERATOR_PATTERN ordnet ein festes Grundmuster mit einem zufälligen Element der Symmetriegruppe in einem
+ *                  Durchlauf um. GENERATOR_BACKTRACK füllt das Gitter per zufälliger Tiefensuche (siehe 'generateGrid') und
+ *                  erreicht damit auch Gitter, die nicht aus dem Grundmuster entstehen können.
  */
-struct sudoku generateFullSudoku() {
-    int i, j, k;
+struct sudoku generateFullSudoku(struct random *random, int generator) {
+    int i, row, column;
     struct sudoku sudokuGrid;
-    int row[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    struct transform transform;
+    uint8_t pattern[GRID_CELLS], grid[GRID_CELLS];
 
-    // Zeilen-Muster (1, 2, 3, 4, ...) mischen
-    shuffle(row, SIZE);
+    INSTRUMENT_BEGIN(TIMER_GENERATE);
 
-    // Sudoku-Muster (Grundmuster) erstellen -> Selbes Muster in jeder Zeile um wenige Spalten nach rechts verschoben
-    for (i = 0; i < 3; i++) {
-        for (j = (9 / 3 * i); j < ((9 / 3 * i) + 3); j++) {
-            for (k = 0; k < 9; k++) {
-                sudokuGrid.value[j][k] = row[k];
-                sudokuGrid.generated[j][k] = 1;
-            }
-
-            shiftRight(row, SIZE, 3);
+    if (generator == GENERATOR_BACKTRACK) {
+        generateGrid(random, grid);
+    } else {
+        // Sudoku-Muster (Grundmuster) erstellen -> Selbe Zeile, je Zeile um BOX_SIZE und je Band um eine weitere Spalte verschoben
+        for (i = 0; i < GRID_CELLS; i++) {
+            row = i / SIZE;
+            column = i % SIZE;
+            pattern[i] = (uint8_t) ((row * BOX_SIZE + row / BOX_SIZE + column) % SIZE + 1);
         }
 
-        shiftRight(row, SIZE, 2);
+        getRandomTransform(&transform, random);
+        applyTransform(&transform, pattern, grid);
     }
 
-    // Zeilen und Spalten innerhalb von Dreiergruppen im Sudoku-Muster mischen
-    for (i = 0; i < SIZE; i++) {
-        sudokuGrid = shuffleRows(sudokuGrid);
-        sudokuGrid = shuffleColumns(sudokuGrid);
+    for (i = 0; i < GRID_CELLS; i++) {
+        sudokuGrid.value[i / SIZE][i % SIZE] = grid[i];
+        sudokuGrid.generated[i / SIZE][i % SIZE] = 1;
     }
 
-    return sudokuGrid;
-
-    /*
-    int i, j;
-    struct sudoku sudokuGrid;
-    struct field field;
-
-    for (i = 0; i < SIZE; i++) {
-    	field.row = i;
-
-    	for (j = 0; j < SIZE; j++) {
-    		field.column = j;
-    		sudokuGrid.generated[i][j] = 1;
-
-    		do {
-    			sudokuGrid.value[i][j] = rand() % 9 + 1;
-    		} while (!checkValue(sudokuGrid, field));
-    	}
-    }
+    INSTRUMENT_COUNT(COUNTER_GRIDS_GENERATED, 1);
+    INSTRUMENT_END(TIMER_GENERATE);
 
     return sudokuGrid;
-    */
 }
 
 /**
@@ -270,222 +110,336 @@ struct sudoku generateFullSudoku() {
  *
  * Parameter:       sudokuGrid (struct sudoku) -> Nimmt den Rückgabewert von Funktion 'generateFullSudoku' entgegen
  * Parameter:       difficulty (int)           -> Gibt einen Schwierigkeitsgrad an (1 = leicht, 2 = mittel und 3 = schwer)
+ * Parameter:       random (struct random *)   -> Zufallsgenerator
  *
  * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
  *
  * Beschreibung:    Erstellt aus dem vollständigen Sudoku eine spielbare Variante mit leeren Feldern.
  */
-struct sudoku makeSodukoPlayable(struct sudoku sudokuGrid, int difficulty) {
-    int emptyFields, i, row, column;
+struct sudoku makeSodukoPlayable(struct sudoku sudokuGrid, int difficulty, struct random *random) {
+    int emptyFields, i, count, cell, cells[GRID_CELLS];
+
+    INSTRUMENT_BEGIN(TIMER_CARVE);
 
     // Leere Felder (Felder zum ausfüllen) nach angegebenen Schwierigkeitsgrad festlegen
-    switch (difficulty) {
-        case 1:
-            emptyFields = 25;
-            break;
+    emptyFields = getEmptyFieldsForDifficulty(difficulty);
 
-        case 3:
-            emptyFields = 45;
-            break;
+    // Liste der noch gefüllten Felder, aus der ohne Wiederholung gezogen wird
+    count = 0;
 
-        case 2:
-        default:
-            emptyFields = 35;
-            break;
+    for (i = 0; i < GRID_CELLS; i++) {
+        if (sudokuGrid.value[i / SIZE][i % SIZE] != 0) {
+            cells[count++] = i;
+        }
     }
 
     // Per Zufall ausgewählte Felder im Sudoku-Muster durch 0 ersetzen (0 = leer)
-    for (i = emptyFields; i > 0; i--) {
-        do {
-            row = rand() % SIZE;
-            column = rand() % SIZE;
-        } while (sudokuGrid.value[row][column] == 0);
+    for (i = emptyFields; i > 0 && count > 0; i--) {
+        cell = getRandomBelow(random, count);
+        swap(&cells[cell], &cells[--count]);
+        cell = cells[count];
 
-        sudokuGrid.value[row][column] = 0;
-        sudokuGrid.generated[row][column] = 0;
+        sudokuGrid.value[cell / SIZE][cell % SIZE] = 0;
+        sudokuGrid.generated[cell / SIZE][cell % SIZE] = 0;
     }
 
+    INSTRUMENT_COUNT(COUNTER_CARVE_ATTEMPTS, emptyFields - i);
+    INSTRUMENT_END(TIMER_CARVE);
+
     return sudokuGrid;
 }
 
 /**
- * Funktion:        shuffle
+ * Funktion:        removeUniqueCell
+ *
+ * Parameter:       board (struct board *)               -> Spielfeld, aus dem das Feld geleert wird
+ * Parameter:       solution (const uint8_t[GRID_CELLS]) -> Lösung des Spielfelds
+ * Parameter:       cell (int)                           -> Zu leerendes Feld
  *
- * Parameter:       array (int[]) -> Array, in welchem die Werte verschoben werden sollen
- * Parameter:       size (int)    -> Anzahl der Elemente im Array
- * Parameter:       steps (int)   -> Gibt an, um wie viele Stellen die Elemente nach rechts verschoben werden sollen
+ * Rückgabewert:    Gibt eine 1 zurück, wenn das Feld geleert wurde, andernfalls eine 0 (das Feld bleibt dann gefüllt)
  *
- * Beschreibung:    Verschiebt alle Elemente im Array um die angegebene Anzahl 'steps' nach rechts.
+ * Beschreibung:    Leert ein Feld, wenn das Sudoku danach weiterhin genau eine Lösung hat. Ist die Ziffer durch die übrigen
+ *                  Ziffern in Zeile, Spalte und Block erzwungen, ändert sich an den Lösungen nichts und der Löser wird nicht benötigt.
  */
-void shiftRight(int array[], int size, int steps) {
-    int i, step;
+static int removeUniqueCell(struct board *board, const uint8_t solution[GRID_CELLS], int cell) {
+    digitMask candidates;
 
-    // Die beiden letzten Werte im Array sukzessiv nach vorne austauschen
-    for (step = 0; step < steps; step++) {
-        for (i = size - 1; i > 0; i--) {
-            swap(&array[i], &array[i - 1]);
-        }
+    setBoardValue(board, cell, 0);
+    candidates = getBoardCandidates(board, cell);
+
+    if ((candidates & (candidates - 1)) == 0 || hasOtherSolutionWithin(board->value, solution, cell, CARVE_BRANCH_BUDGET) == 0) {
+        return 1;
     }
 
-    return;
+    setBoardValue(board, cell, solution[cell]);
+
+    return 0;
 }
 
 /**
- * Funktion:        shuffle
+ * Funktion:        carveUnique
  *
- * Parameter:       array (int[]) -> Array, in welchem die Werte zufällig gemischt werden
- * Parameter:       size (int)    -> Anzahl der Elemente im Array
+ * Parameter:       sudokuGrid (struct sudoku *) -> Vollständig gelöstes Sudoku, enthält nach dem Funktionsaufruf die leeren Felder
+ * Parameter:       difficulty (int)             -> Gibt einen Schwierigkeitsgrad an (1 = leicht, 2 = mittel und 3 = schwer)
+ * Parameter:       random (struct random *)     -> Zufallsgenerator
  *
- * Beschreibung:    Mischt zufällig die Werte in einem Array.
+ * Beschreibung:    Gemeinsamer Teil von 'makeSodukoPlayableUnique' und 'makeSodukoPlayableRated' ohne Zeitmessung, damit der
+ *                  Rückfall in 'makeSodukoPlayableRated' nicht ein zweites Mal unter TIMER_CARVE gezählt wird.
  */
-void shuffle(int array[], int size) {
-    int i, x, y;
+static void carveUnique(struct sudoku *sudokuGrid, int difficulty, struct random *random) {
+    int emptyFields, i, cell, removed;
+    int cells[GRID_CELLS];
+    uint8_t full[GRID_CELLS];
+    struct board board;
+
+    emptyFields = getEmptyFieldsForDifficulty(difficulty);
+    boardFromSudoku(sudokuGrid, &board);
+    memcpy(full, board.value, sizeof(full));
 
-    // Zwei per Zufall ausgewählte Werte im Array austauschen
-    for (i = 0; i < size; i++) {
-        x = rand() % size;
-        y = rand() % size;
+    for (i = 0; i < GRID_CELLS; i++) {
+        cells[i] = i;
+    }
+
+    // Reihenfolge der Felder zufällig festlegen
+    shuffle(cells, GRID_CELLS, random);
+
+    // Felder in dieser Reihenfolge leeren, solange das Sudoku eindeutig lösbar bleibt
+    removed = 0;
+
+    for (i = 0; i < GRID_CELLS && removed < emptyFields; i++) {
+        cell = cells[i];
 
-        swap(&array[x], &array[y]);
+        if (removeUniqueCell(&board, full, cell)) {
+            sudokuGrid->value[cell / SIZE][cell % SIZE] = 0;
+            sudokuGrid->generated[cell / SIZE][cell % SIZE] = 0;
+            removed++;
+        }
     }
 
+    INSTRUMENT_COUNT(COUNTER_CARVE_ATTEMPTS, i);
+
     return;
 }
 
 /**
- * Funktion:        shuffleRows
+ * Funktion:        makeSodukoPlayableUnique
  *
- * Parameter:       sudokuGrid (struct sudoku) -> Sudoku, welches manipuliert werden soll
- * Parameter:       quadrant (int)             -> Dreiergruppe in der getauscht wird (0, 1 oder 2)
- * Parameter:       x (int)                    -> Zeile 1 (0, 1 oder 2)
- * Parameter:       y (int)                    -> Zeile 2 (0, 1 oder 2)
+ * Parameter:       sudokuGrid (struct sudoku) -> Vollständig gelöstes Sudoku (z.B. Rückgabewert von Funktion 'generateFullSudoku')
+ * Parameter:       difficulty (int)           -> Gibt einen Schwierigkeitsgrad an (1 = leicht, 2 = mittel und 3 = schwer)
+ * Parameter:       random (struct random *)   -> Zufallsgenerator
  *
  * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
  *
- * Beschreibung:    Mischt Zeilen im Sudoku durcheinander.
+ * Beschreibung:    Erstellt aus dem vollständigen Sudoku eine spielbare Variante, die weiterhin genau eine Lösung hat.
+ *                  Ein Feld wird nur geleert, wenn der Löser danach keine Lösung mit einer anderen Ziffer in diesem Feld findet.
+ *                  Lässt sich kein weiteres Feld entfernen, enthält das Sudoku weniger leere Felder als der Schwierigkeitsgrad vorsieht.
  */
-struct sudoku shuffleRows(struct sudoku sudokuGrid) {
-    int quadrant, x, y, i;
+struct sudoku makeSodukoPlayableUnique(struct sudoku sudokuGrid, int difficulty, struct random *random) {
+    INSTRUMENT_BEGIN(TIMER_CARVE);
+    carveUnique(&sudokuGrid, difficulty, random);
+    INSTRUMENT_END(TIMER_CARVE);
 
-    // Dreiergruppe und Zeilen darin per Zufall auswählen
-    for (i = 0; i < SIZE; i++) {
-        quadrant = rand() % SIZE / 3;
-        x = rand() % SIZE / 3;
-        y = rand() % SIZE / 3;
+    return sudokuGrid;
+}
+
+/**
+ * Funktion:        rateRemoved
+ *
+ * Parameter:       full (const uint8_t[GRID_CELLS]) -> Vollständig gelöstes Gitter
+ * Parameter:       removed (const int[])            -> Geleerte Felder in der Reihenfolge, in der sie geleert wurden
+ * Parameter:       count (int)                      -> Anzahl der zu leerenden Felder vom Anfang der Liste
+ *
+ * Rückgabewert:    Gibt den Schwierigkeitsgrad des Gitters zurück (siehe 'ratePuzzleDifficulty')
+ */
+static int rateRemoved(const uint8_t full[GRID_CELLS], const int removed[], int count) {
+    uint8_t grid[GRID_CELLS];
+    int i;
 
-        // Zeilen in Dreiergruppe austauschen
-        sudokuGrid = swapRows(sudokuGrid, quadrant, x, y);
+    memcpy(grid, full, sizeof(grid));
+
+    for (i = 0; i < count; i++) {
+        grid[removed[i]] = 0;
     }
 
-    return sudokuGrid;
+    return ratePuzzleDifficulty(grid, RATING_STEP_BUDGET);
 }
 
 /**
- * Funktion:        shuffleColumns
+ * Funktion:        makeSodukoPlayableRated
  *
- * Parameter:       sudokuGrid (struct sudoku) -> Sudoku, welches manipuliert werden soll
- * Parameter:       quadrant (int)             -> Dreiergruppe in der getauscht wird (0, 1 oder 2)
- * Parameter:       x (int)                    -> Zeile 1 (0, 1 oder 2)
- * Parameter:       y (int)                    -> Zeile 2 (0, 1 oder 2)
+ * Parameter:       sudokuGrid (struct sudoku) -> Vollständig gelöstes Sudoku (z.B. Rückgabewert von Funktion 'generateFullSudoku')
+ * Parameter:       difficulty (int)           -> Gibt einen Schwierigkeitsgrad an (1 = leicht, 2 = mittel und 3 = schwer)
+ * Parameter:       random (struct random *)   -> Zufallsgenerator
  *
  * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
  *
- * Beschreibung:    Mischt Spalten im Sudoku durcheinander.
- */
-struct sudoku shuffleColumns(struct sudoku sudokuGrid) {
-    int quadrant, x, y, i;
+ * Beschreibung:    Wie 'makeSodukoPlayableUnique', der Schwierigkeitsgrad richtet sich aber nach den benötigten Lösungstechniken
+ *                  (siehe 'ratePuzzleDifficulty') statt nur nach der Anzahl leerer Felder. Bewertet wird erst bei der Mindestzahl
+ *                  leerer Felder und danach nur alle RATING_CARVE_STEP Felder; ist der Schwierigkeitsgrad erreicht, wird die kleinste
+ *                  ausreichende Anzahl per Intervallhalbierung gesucht. Ein Feld, das das Sudoku zu schwer machen würde, bleibt
+ *                  gefüllt. Gelingt das in RATING_ATTEMPTS Versuchen nicht, wird wie bei 'makeSodukoPlayableUnique' nur nach
+ *                  Anzahl geleert (in derselben Zeitmessung).
+ */
+struct sudoku makeSodukoPlayableRated(struct sudoku sudokuGrid, int difficulty, struct random *random) {
+    int emptyFields, attempt, i, cell, count, rated, middleRated, low, high, middle;
+    int cells[GRID_CELLS], removed[GRID_CELLS];
+    uint8_t full[GRID_CELLS];
+    struct board board, fullBoard;
+
+    INSTRUMENT_BEGIN(TIMER_CARVE);
+    emptyFields = getEmptyFieldsForDifficulty(difficulty);
+    boardFromSudoku(&sudokuGrid, &fullBoard);
+    memcpy(full, fullBoard.value, sizeof(full));
+    rated = 0;
+    count = 0;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        cells[i] = i;
+    }
+
+    for (attempt = 0; attempt < RATING_ATTEMPTS && rated != difficulty; attempt++) {
+        INSTRUMENT_COUNT(COUNTER_CARVE_RETRIES, attempt > 0);
+        board = fullBoard;
+
+        // Reihenfolge der Felder je Versuch neu festlegen
+        shuffle(cells, GRID_CELLS, random);
+
+        // 'low' leere Felder sind bekanntermaßen zu leicht (0 = noch nicht bewertet)
+        count = 0;
+        low = 0;
+        rated = 0;
+        i = 0;
+
+        while (rated < difficulty) {
+            // Bis zur Mindestzahl leerer Felder, danach je RATING_CARVE_STEP weitere Felder leeren
+            for (; i < GRID_CELLS && count < (low < emptyFields ? emptyFields : low + RATING_CARVE_STEP); i++) {
+                if (removeUniqueCell(&board, full, cells[i])) {
+                    removed[count++] = cells[i];
+                }
+            }
 
-    // Dreiergruppe und Spalten darin per Zufall auswählen
-    for (i = 0; i < SIZE; i++) {
-        quadrant = rand() % SIZE / 3;
-        x = rand() % SIZE / 3;
-        y = rand() % SIZE / 3;
+            if (count < emptyFields || count == low) {
+                break;
+            }
+
+            rated = rateRemoved(full, removed, count);
 
-        // Spalten in Dreiergruppe austauschen
-        sudokuGrid = swapColumns(sudokuGrid, quadrant, x, y);
+            if (rated < difficulty) {
+                low = count;
+                continue;
+            }
+
+            if (count == emptyFields) {
+                break;
+            }
+
+            // Kleinste ausreichende Anzahl leerer Felder seit der letzten Bewertung per Intervallhalbierung suchen
+            high = count;
+
+            while (high - low > 1) {
+                middle = low + (high - low) / 2;
+                middleRated = rateRemoved(full, removed, middle);
+
+                if (middleRated >= difficulty) {
+                    high = middle;
+                    rated = middleRated;
+                } else {
+                    low = middle;
+                }
+            }
+
+            if (rated == difficulty) {
+                count = high;
+                break;
+            }
+
+            // Das Feld macht das Sudoku zu schwer und bleibt gefüllt. Mit mehr Vorgaben bleibt es eindeutig lösbar,
+            // daher wird mit den übrigen geleerten Feldern weitergesucht.
+            cell = removed[low];
+            setBoardValue(&board, cell, full[cell]);
+            memmove(&removed[low], &removed[high], (count - high) * sizeof(removed[0]));
+            count--;
+            rated = 0;
+        }
+
+        INSTRUMENT_COUNT(COUNTER_CARVE_ATTEMPTS, i);
+    }
+
+    if (rated == difficulty) {
+        for (i = 0; i < count; i++) {
+            cell = removed[i];
+            sudokuGrid.value[cell / SIZE][cell % SIZE] = 0;
+            sudokuGrid.generated[cell / SIZE][cell % SIZE] = 0;
+        }
+    } else {
+        carveUnique(&sudokuGrid, difficulty, random);
     }
 
+    INSTRUMENT_END(TIMER_CARVE);
+
     return sudokuGrid;
 }
 
 /**
- * Funktion:        swap
+ * Funktion:        getEmptyFieldsForDifficulty
  *
- * Parameter:       *x (int) -> Wert 1
- * Parameter:       *y (int) -> Wert 2
+ * Parameter:       difficulty (int) -> Gibt einen Schwierigkeitsgrad an (1 = leicht, 2 = mittel und 3 = schwer)
  *
- * Beschreibung:    Vertauscht die Werte von zwei Speicheradressen bzw. Variablen.
+ * Rückgabewert:    Gibt die Anzahl der zu leerenden Felder zurück
+ *
+ * Beschreibung:    Legt die Anzahl leerer Felder (Felder zum ausfüllen) nach Schwierigkeitsgrad fest (bei 9x9 25, 35 und 45,
+ *                  bei anderen Größen im selben Verhältnis zur Anzahl der Felder).
  */
-void swap(int *x, int *y) {
-    int temp = *x;
-    *x = *y;
-    *y = temp;
+int getEmptyFieldsForDifficulty(int difficulty) {
+    switch (difficulty) {
+        case EASY:
+            return 25 * GRID_CELLS / 81;
 
-    return;
+        case DIFFICULT:
+            return 45 * GRID_CELLS / 81;
+
+        case MEDIUM:
+        default:
+            return 35 * GRID_CELLS / 81;
+    }
 }
 
 /**
- * Funktion:        swapRows
+ * Funktion:        shuffle
  *
- * Parameter:       sudokuGrid (struct sudoku) -> Sudoku, welches manipuliert werden soll
- * Parameter:       quadrant (int)             -> Dreiergruppe in der getauscht wird (0, 1 oder 2)
- * Parameter:       x (int)                    -> Zeile 1 (0, 1 oder 2)
- * Parameter:       y (int)                    -> Zeile 2 (0, 1 oder 2)
+ * Parameter:       array (int[])            -> Array, in welchem die Werte zufällig gemischt werden
+ * Parameter:       size (int)               -> Anzahl der Elemente im Array
+ * Parameter:       random (struct random *) -> Zufallsgenerator
  *
- * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
- *
- * Beschreibung:    Tauscht zwei Zeilen im Sudoku miteinander aus.
+ * Beschreibung:    Mischt zufällig die Werte in einem Array. Jede Reihenfolge ist gleich wahrscheinlich (Fisher-Yates).
  */
-struct sudoku swapRows(struct sudoku sudokuGrid, int quadrant, int x, int y) {
+void shuffle(int array[], int size, struct random *random) {
     int i;
-    int indexX;
-    int indexY;
-
-    // Prüfen ob übergebene Parameter legal sind
-    if ((quadrant == 0 || quadrant == 1 || quadrant == 2) && (x == 0 || x == 1 || x == 2) && (y == 0 || y == 1 || y == 2)) {
-        // Zeilen in Dreiergruppe errechnen
-        indexX = (9 / 3 * quadrant) + x;
-        indexY = (9 / 3 * quadrant) + y;
-
-        for (i = 0; i < SIZE; i++) {
-            swap(&sudokuGrid.value[indexX][i], &sudokuGrid.value[indexY][i]);
-            swap(&sudokuGrid.generated[indexX][i], &sudokuGrid.generated[indexY][i]);
-        }
+
+    // Jeden Wert mit einem per Zufall ausgewählten Wert davor (oder sich selbst) austauschen
+    for (i = size - 1; i > 0; i--) {
+        swap(&array[i], &array[getRandomBelow(random, i + 1)]);
     }
 
-    return sudokuGrid;
+    INSTRUMENT_COUNT(COUNTER_SHUFFLE_SWAPS, size > 1 ? size - 1 : 0);
+
+    return;
 }
 
 /**
- * Funktion:        swapColumns
- *
- * Parameter:       sudokuGrid (struct sudoku) -> Sudoku, welches manipuliert werden soll
- * Parameter:       quadrant (int)             -> Dreiergruppe in der getauscht wird  (0, 1 oder 2)
- * Parameter:       x (int)                    -> Spalte 1 (0, 1 oder 2)
- * Parameter:       y (int)                    -> Spalte 2 (0, 1 oder 2)
+ * Funktion:        swap
  *
- * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
+ * Parameter:       *x (int) -> Wert 1
+ * Parameter:       *y (int) -> Wert 2
  *
- * Beschreibung:    Tauscht zwei Spalten im Sudoku miteinander aus.
+ * Beschreibung:    Vertauscht die Werte von zwei Speicheradressen bzw. Variablen.
  */
-struct sudoku swapColumns(struct sudoku sudokuGrid, int quadrant, int x, int y) {
-    int i;
-    int indexX;
-    int indexY;
-
-    // Prüfen ob übergebene Parameter legal sind
-    if ((quadrant == 0 || quadrant == 1 || quadrant == 2) && (x == 0 || x == 1 || x == 2) && (y == 0 || y == 1 || y == 2)) {
-        // Spalten in Dreiergruppe errechnen
-        indexX = (9 / 3 * quadrant) + x;
-        indexY = (9 / 3 * quadrant) + y;
-
-        for (i = 0; i < SIZE; i++) {
-            swap(&sudokuGrid.value[i][indexX], &sudokuGrid.value[i][indexY]);
-            swap(&sudokuGrid.generated[i][indexX], &sudokuGrid.generated[i][indexY]);
-        }
-    }
+void swap(int *x, int *y) {
+    int temp = *x;
+    *x = *y;
+    *y = temp;
 
-    return sudokuGrid;
+    return;
 }
 
 /**
@@ -498,28 +452,28 @@ struct sudoku swapColumns(struct sudoku sudokuGrid, int quadrant, int x, int y)
  * Beschreibung:    Prüft ob das Sudoku richtig und vollsträndig gelöst wurde.
  */
 int checkSudoku(struct sudoku sudokuGrid) {
-    int i, j;
+    int i, j, valid;
     struct field field;
 
+    INSTRUMENT_COUNT(COUNTER_BOARD_SCANS, 1);
+    INSTRUMENT_BEGIN(TIMER_VALIDATE);
+
     // Wenn es noch leere Felder gibt, kann das Sudoku noch nicht gelöst sein
-    if (countEmptyFields(sudokuGrid) > 0) {
-        return 0;
-    }
+    valid = countEmptyFields(sudokuGrid) == 0;
 
     // Jedes Feld einzeln prüfen
-    for (i = 0; i < SIZE; i++) {
+    for (i = 0; valid && i < SIZE; i++) {
         field.row = i;
 
-        for (j = 0; j < SIZE; j++) {
+        for (j = 0; valid && j < SIZE; j++) {
             field.column = j;
-
-            if (!checkValue(sudokuGrid, field)) {
-                return 0;
-            }
+            valid = checkValue(sudokuGrid, field);
         }
     }
 
-    return 1;
+    INSTRUMENT_END(TIMER_VALIDATE);
+
+    return valid;
 }
 
 /**
@@ -533,6 +487,8 @@ int checkSudoku(struct sudoku sudokuGrid) {
  * Beschreibung:    Prüft ob ein Wert im Sudoku richtig gesetzt wurde.
  */
 int checkValue(struct sudoku sudokuGrid, struct field field) {
+    INSTRUMENT_COUNT(COUNTER_VALUE_CHECKS, 1);
+
     // Feld in Zeile, Reihe und Gruppe (3x3) auf Einmaligkeit prüfen
     if (checkRow(sudokuGrid, field) && checkColumn(sudokuGrid, field) && checkGroup(sudokuGrid, field)) {
         return 1;
@@ -607,20 +563,20 @@ int checkColumn(struct sudoku sudokuGrid, struct field field) {
  *
  * Rückgabewert:    Gibt eine 0 für falsch zurück und eine 1 für korrekt (1 wird auch zurückgegeben, wenn der Wert aktuell korrekt ist, in der Gesamtlösung jedoch nicht)
  *
- * Beschreibung:    Prüft ob ein Wert in einem 9x9 Block richtig gesetzt wurde.
+ * Beschreibung:    Prüft ob ein Wert in einem Block richtig gesetzt wurde.
  */
 int checkGroup(struct sudoku sudokuGrid, struct field field) {
     int row, column, i, j, counter;
     counter = 0;
 
     //Quadranten berechnen
-    row = (field.row - (field.row % 3)) / 3;
-    column = (field.column - (field.column % 3)) / 3;
+    row = field.row / BOX_SIZE;
+    column = field.column / BOX_SIZE;
 
-    // Feld in Gruppe (3x3) auf Einmaligkeit prüfen
-    for (i = 0; i < SIZE / 3; i++) {
-        for (j = 0; j < SIZE / 3; j++) {
-            if (sudokuGrid.value[row * 3 + i][column * 3 + j] == sudokuGrid.value[field.row][field.column]) {
+    // Feld im Block auf Einmaligkeit prüfen
+    for (i = 0; i < BOX_SIZE; i++) {
+        for (j = 0; j < BOX_SIZE; j++) {
+            if (sudokuGrid.value[row * BOX_SIZE + i][column * BOX_SIZE + j] == sudokuGrid.value[field.row][field.column]) {
                 counter++;
             }
         }
@@ -646,12 +602,12 @@ int checkGroup(struct sudoku sudokuGrid, struct field field) {
 int charToInt(char charakter) {
     int result = 0;
 
-    if (charakter >= 65 && charakter <= 73) {
-        // Großbuchstabe A - I -> ASCII Code von A subtrahieren
-        result = charakter - 65;
-    } else if (charakter >= 97 && charakter <= 105) {
-        // Kleinbuchstabe a - i -> ASCII Code von a subtrahieren
-        result = charakter - 97;
+    if (charakter >= 'A' && charakter < 'A' + SIZE) {
+        // Großbuchstabe A - I (bei 9x9) -> ASCII Code von A subtrahieren
+        result = charakter - 'A';
+    } else if (charakter >= 'a' && charakter < 'a' + SIZE) {
+        // Kleinbuchstabe a - i (bei 9x9) -> ASCII Code von a subtrahieren
+        result = charakter - 'a';
     } else {
         result--;
     }
@@ -708,34 +664,13 @@ int checkAndConvertInputChar(char inputString[]) {
     return charToInt(inputString[0]);
 }
 
-/**
- * Funktion:        readLine
- *
- * Parameter:       inputString (char[]) -> Zeichenkette in dem die Eingabe geschrieben wird
- *
- * Beschreibung:    Liest eine Zeichenkette ein.
- */
-void readLine(char inputString[]) {
-    int strLen;
-
-    fflush(stdin);
-    fgets(inputString, STRLEN, stdin);
-    strLen = strlen(inputString);
-
-    if (inputString[strLen - 1] == '\n') {
-        inputString[strLen - 1] = '\0';
-    }
-
-    return;
-}
-
 /**
  * Funktion:        alterValue
  *
  * Parameter:       sudokuGrid (struct sudoku) -> Sudoku-Muster, in dem die Werte stehen
  * Parameter:       field (struct field)       -> Koordinaten vom Feld, in welchem der Wert geändert werden soll
  * Parameter:       newValue (int)             -> Neuer Wert für das Feld
- * Parameter:       *error (int)               -> Enthält nach dem Funktionsaufruf: 1 = Feld kann nicht geändert werden, 2 = Neuer Wert ist kleiner als 1, 3 = Neuer Wert ist größer als 9
+ * Parameter:       *error (int)               -> Enthält nach dem Funktionsaufruf: 1 = Feld kann nicht geändert werden, 2 = Neuer Wert ist kleiner als 1, 3 = Neuer Wert ist größer als SIZE
  *
  * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
  *
@@ -748,11 +683,11 @@ struct sudoku alterValue(struct sudoku sudokuGrid, struct field field, int newVa
         return sudokuGrid;
     }
 
-    // Wenn der Wert im Zahlenbereich der natürlichen Zahlen von 1 bis 9 liegt, Wert im Feld ändern
+    // Wenn der Wert im Zahlenbereich der natürlichen Zahlen von 1 bis SIZE liegt, Wert im Feld ändern
     if (newValue < 0) {
         *error = 2;
         return sudokuGrid;
-    } else if (newValue > 9) {
+    } else if (newValue > SIZE) {
         *error = 3;
         return sudokuGrid;
     } else {
@@ -768,34 +703,36 @@ struct sudoku alterValue(struct sudoku sudokuGrid, struct field field, int newVa
  *
  * Parameter:       sudokuGridSolved (struct sudoku) -> Sudoku-Muster, in dem die Werte stehen (fertig gelöst)
  * Parameter:       sudokuGrid (struct sudoku)       -> Sudoku-Muster, in dem die Werte stehen
+ * Parameter:       random (struct random *)         -> Zufallsgenerator
  *
  * Rückgabewert:    Gibt die Struktur 'sudoku' zurück
  *
  * Beschreibung:    Schreibt einen neuen Wert in ein zufälliges Feld im Sudoku-Muster.
  */
-struct sudoku fillRandomField(struct sudoku sudokuGridSolved, struct sudoku sudokuGrid) {
+struct sudoku fillRandomField(struct sudoku sudokuGridSolved, struct sudoku sudokuGrid, struct random *random) {
     struct field field;
-    struct sudoku sudoku;
-    int error;
+    int i, count, error, cells[GRID_CELLS];
 
-    error = 1;
-    sudoku = sudokuGrid;
+    // Liste der leeren, änderbaren Felder, aus der genau ein Feld gezogen wird
+    count = 0;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        if (sudokuGrid.value[i / SIZE][i % SIZE] == 0 && sudokuGrid.generated[i / SIZE][i % SIZE] != 1) {
+            cells[count++] = i;
+        }
+    }
 
-    // Es kann nur ein Feld geüllt werden, wenn es noch leere Felder gibt
-    if (countEmptyFields(sudokuGrid) > 0) {
-        do {
-            // Feld so lange zufällig wählen, bis alterValue() beim Ändern keinen Fehler zurückgibt
-            field.row = rand() % 9;
-            field.column = rand() % 9;
+    // Es kann nur ein Feld gefüllt werden, wenn es noch leere Felder gibt
+    if (count > 0) {
+        i = cells[getRandomBelow(random, count)];
+        field.row = i / SIZE;
+        field.column = i % SIZE;
 
-            if (sudokuGrid.value[field.row][field.column] == 0) {
-                // Feld aus dem Sudoku mit dem selben Feld aus der Lösung ersetzen
-                sudoku = alterValue(sudoku, field, sudokuGridSolved.value[field.row][field.column], &error);
-            }
-        } while (error != 0);
+        // Feld aus dem Sudoku mit dem selben Feld aus der Lösung ersetzen
+        sudokuGrid = alterValue(sudokuGrid, field, sudokuGridSolved.value[field.row][field.column], &error);
     }
 
-    return sudoku;
+    return sudokuGrid;
 }
 
 /**
@@ -826,70 +763,101 @@ int countEmptyFields(struct sudoku sudokuGrid) {
 /**
  * Ließt, intepretiert und überprüft eine Datei in ein Sudoku
  * Diese Funktion in den Views nutzen!
+ * Gelesen wird das erste Rätsel der Datei (kommagetrennt oder als Zeile mit GRID_CELLS Zeichen).
+ * Leere Felder ('0' oder '.') sind erlaubt: Das Rätsel wird beim Einlesen gelöst, ohne Lösung oder mit mehreren
+ * Lösungen wird es abgelehnt.
  *
  * @param dateiPfad
  * @param errorCode
+ * @param errorLine Enthält bei einem Fehler in der Datei die Zeilennummer, sonst 0
+ * @param solution Enthält danach die (eindeutige) Lösung des Rätsels
  *
  * @return Das geparste und überprüfte Sudoku
  */
-struct sudoku getSudokuFromFile(char path[1024], int *error) {
+struct sudoku getSudokuFromFile(char path[1024], int *error, int *errorLine, struct sudoku *solution) {
     struct sudoku sudoku;
-    FILE *fileHandle;
-    if (verifyFilePath(path) == 1) {
-        *error = PARSER_VALID;
-        fileHandle = fopen(path, "r");
-        sudoku = parseToSudoku(fileHandle, error);
-        fclose(fileHandle);
-    } else {
-        *error = PARSER_FILE_INACCESSIBLE;
+    struct puzzleReader reader;
+    uint8_t grid[GRID_CELLS], solved[GRID_CELLS];
+    int i, hasSolution;
+
+    INSTRUMENT_BEGIN(TIMER_PARSE);
+    memset(&sudoku, 0, sizeof(sudoku));
+    *errorLine = 0;
+    *error = openPuzzleReader(&reader, path);
+
+    if (*error == PARSER_VALID) {
+        if (readPuzzle(&reader, grid, solved, &hasSolution) == READER_PUZZLE) {
+            for (i = 0; i < GRID_CELLS; i++) {
+                sudoku.value[i / SIZE][i % SIZE] = grid[i];
+                sudoku.generated[i / SIZE][i % SIZE] = grid[i] != 0;
+            }
+
+            *error = checkParsedSudoku(sudoku);
+
+            if (*error == PARSER_VALID) {
+                *error = solveParsedSudoku(sudoku, solution);
+            }
+        } else {
+            *error = PARSER_SUDOKU_NUMBERS_INVALID;
+            *errorLine = reader.line;
+        }
+
+        closePuzzleReader(&reader);
     }
 
+    INSTRUMENT_END(TIMER_PARSE);
+
     return sudoku;
 }
 
 /**
- * Ließt und parsed eine Datei in ein Sudoku.
+ * Löst ein eingelesenes Rätsel und prüft in derselben Suche, ob die Lösung eindeutig ist.
+ * Hat es keine Lösung, wird zwischen sich widersprechenden Vorgaben und einem unlösbaren Rätsel unterschieden.
  *
- * @param dateiHandle
- * @param errorCode
+ * @param sudoku Geprüftes Rätsel (siehe checkParsedSudoku)
+ * @param solution Enthält danach die Lösung (nur bei PARSER_VALID)
  *
- * @return geparstesSudoku
+ * @return Eine PARSER_* Konstante die den Fehlercode angibt.
  */
-struct sudoku parseToSudoku(FILE *fileHandle, int *error) {
-    struct sudoku sudoku;
-    int i,j;
-    for (i = 0; i < 9; i++) {
-        // Lese eine Zeile der Datei aus, und
-        // fülle die entsprechende Zeile  im Sudoku
-        fscanf(
-            fileHandle,
-            "%i,%i,%i,%i,%i,%i,%i,%i,%i",
-            &sudoku.value[i][0],
-            &sudoku.value[i][1],
-            &sudoku.value[i][2],
-            &sudoku.value[i][3],
-            &sudoku.value[i][4],
-            &sudoku.value[i][5],
-            &sudoku.value[i][6],
-            &sudoku.value[i][7],
-            &sudoku.value[i][8]
-        );
-    };
-
-    for (i = 0; i < 9; i++) {
-        for (j = 0; j < 9; j++) {
-            sudoku.generated[i][j] = 1;
+int solveParsedSudoku(struct sudoku sudoku, struct sudoku *solution) {
+    unsigned char grid[GRID_CELLS], solved[GRID_CELLS];
+    struct field field;
+    int i, solutions;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        grid[i] = sudoku.value[i / SIZE][i % SIZE];
+    }
+
+    solutions = solveGridUnique(grid, solved);
+
+    if (solutions == 0) {
+        for (i = 0; i < GRID_CELLS; i++) {
+            field.row = i / SIZE;
+            field.column = i % SIZE;
+
+            if (grid[i] != 0 && !checkValue(sudoku, field)) {
+                return PARSER_SUDOKU_INVALID;
+            }
         }
+
+        return PARSER_SUDOKU_UNSOLVABLE;
     }
 
-    *error = checkParsedSudoku(sudoku);
+    if (solutions > 1) {
+        return PARSER_SUDOKU_AMBIGUOUS;
+    }
 
-    return sudoku;
+    for (i = 0; i < GRID_CELLS; i++) {
+        solution->value[i / SIZE][i % SIZE] = solved[i];
+        solution->generated[i / SIZE][i % SIZE] = 1;
+    }
+
+    return PARSER_VALID;
 }
 
 /**
  * Überprüft ob das Sudoku nur Zahlen von (einschließlich)
- * 1 bis 9 enthält. Überprüft des Weiteren ob sudoku.generated nur 1 enthält.
+ * 0 (leer) bis SIZE enthält. Überprüft des Weiteren ob sudoku.generated genau bei den vorgegebenen Zahlen 1 enthält.
  *
  * @param sudoku Sudoku to check
  *
@@ -898,62 +866,14 @@ struct sudoku parseToSudoku(FILE *fileHandle, int *error) {
 int checkParsedSudoku(struct sudoku sudoku) {
     int i, j, value = 0, generated = 0;
     int isError = PARSER_VALID;
-    for (i = 0; i < 9; i++) {
-        for (j = 0; j < 9; j++) {
+    for (i = 0; i < SIZE; i++) {
+        for (j = 0; j < SIZE; j++) {
             value = sudoku.value[i][j];
             generated = sudoku.generated[i][j];
-            if (value < 1 || value > 9 || generated != 1) {
+            if (value < 0 || value > SIZE || generated != (value != 0)) {
                 isError = PARSER_SUDOKU_NUMBERS_INVALID;
             }
         }
     }
     return isError;
 }
-
-/**
- * Zeigt eine Fehlernachricht entsprechend ihrer Bedeutung an.
- *
- * @param errorCode Fehlercode, zu welchem eine Nachricht darzustellen ist.
- */
-void showParserErrorMessage(int errorCode) {
-    switch (errorCode) {
-        case (PARSER_FILE_INACCESSIBLE):
-            printf("Die angegebene Datei existiert nicht, oder auf sie kann nicht zugegriffen werden.\n");
-            printf("Bitte ueberpruefen sie Ihre Eingabe und versuchen es erneut!\n\n");
-            break;
-
-        case (PARSER_SUDOKU_NUMBERS_INVALID):
-            printf("Die Datei enthaelt ungueltigen Eingaben.");
-            printf("Sie sollte neun Reihen enthalten,\nwelche wie folgt aufgebaut sein sollten:\n");
-            printf("\"i,i,i,i,i,i,i,i,i\" (i steht fuer eine beliebige Zahl von 1-9)\n\n");
-            break;
-
-        case (PARSER_SUDOKU_INVALID):
-            printf("Das Sudoku ist kein gueltiges Sudoku.\n");
-            printf("Die Zahlen in einer Reihe, Zeile und in einem 3x3 Quadrat muessen einmalig sein.\n\n");
-            break;
-    }
-    return;
-}
-
-/**
- * Verifizieret ob dateiPfad eine lesbare Datei identifiziert.
- *
- * @param dateiPfad
- *
- * @return 1 wenn der Pfad
- */
-int verifyFilePath(char path[1024]) {
-    int fileExists;
-    FILE *fileHandle;
-    fileHandle = fopen(path, "r");
-
-    if (fileHandle == NULL) {
-        fileExists = 0;
-    } else {
-        fileExists = 1;
-        fclose(fileHandle);
-    }
-
-    return fileExists;
-}
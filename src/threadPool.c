@@ -0,0 +1,218 @@
+#include "../header/sudokuCore.h"
+
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// Warteschlange eines Threads: noch offene Aufgaben von 'head' bis ausschließlich 'tail'
+struct taskQueue {
+    pthread_mutex_t lock;
+    long long head;
+    long long tail;
+    char padding[64];
+};
+
+// Gemeinsamer Zustand aller Threads
+struct threadPool {
+    struct taskQueue *queues;
+    int threadCount;
+    taskFunction function;
+    void *context;
+};
+
+// Auftrag eines Threads
+struct poolWorker {
+    struct threadPool *pool;
+    int index;
+};
+
+/**
+ * Funktion:        takeTask
+ *
+ * Parameter:       queue (struct taskQueue *) -> Eigene Warteschlange
+ * Parameter:       task (long long *)         -> Enthält nach dem Funktionsaufruf die entnommene Aufgabe
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn eine Aufgabe entnommen wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Der Besitzer arbeitet seine Warteschlange von vorne ab.
+ */
+static int takeTask(struct taskQueue *queue, long long *task) {
+    int found;
+
+    pthread_mutex_lock(&queue->lock);
+    found = queue->head < queue->tail;
+
+    if (found) {
+        *task = queue->head++;
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return found;
+}
+
+/**
+ * Funktion:        stealTasks
+ *
+ * Parameter:       pool (struct threadPool *) -> Thread-Pool
+ * Parameter:       thief (int)                -> Index des Threads, dessen Warteschlange leer ist
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn Aufgaben übernommen wurden, andernfalls eine 0 (alle Warteschlangen sind leer)
+ *
+ * Beschreibung:    Übernimmt die hintere Hälfte der Aufgaben eines anderen Threads. Ein Thread, der an einer schweren Aufgabe
+ *                  hängt, gibt so seine restlichen Aufgaben an die freien Threads ab. Da keine neuen Aufgaben entstehen,
+ *                  ist die Arbeit beendet, sobald ein vollständiger Durchlauf keine Aufgaben mehr findet.
+ */
+static int stealTasks(struct threadPool *pool, int thief) {
+    struct taskQueue *victim, *own;
+    long long middle, tail;
+    int i;
+
+    own = &pool->queues[thief];
+
+    for (i = 1; i < pool->threadCount; i++) {
+        victim = &pool->queues[(thief + i) % pool->threadCount];
+
+        pthread_mutex_lock(&victim->lock);
+
+        if (victim->head >= victim->tail) {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+
+        tail = victim->tail;
+        middle = victim->head + (victim->tail - victim->head) / 2;
+        victim->tail = middle;
+        pthread_mutex_unlock(&victim->lock);
+
+        pthread_mutex_lock(&own->lock);
+        own->head = middle;
+        own->tail = tail;
+        pthread_mutex_unlock(&own->lock);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Funktion:        runWorker
+ *
+ * Parameter:       argument (void *) -> Auftrag des Threads (struct poolWorker)
+ *
+ * Rückgabewert:    Gibt NULL zurück
+ *
+ * Beschreibung:    Arbeitet die eigene Warteschlange ab und stiehlt danach so lange Aufgaben, bis keine mehr übrig sind.
+ */
+static void *runWorker(void *argument) {
+    struct poolWorker *worker = argument;
+    struct threadPool *pool = worker->pool;
+    long long task;
+
+    do {
+        while (takeTask(&pool->queues[worker->index], &task)) {
+            pool->function(task, worker->index, pool->context);
+        }
+    } while (stealTasks(pool, worker->index));
+
+    return NULL;
+}
+
+/**
+ * Funktion:        runTasks
+ *
+ * Parameter:       taskCount (long long)    -> Anzahl der Aufgaben
+ * Parameter:       threadCount (int)        -> Anzahl der Threads
+ * Parameter:       function (taskFunction)  -> Funktion, die für jede Aufgabe genau einmal aufgerufen wird
+ * Parameter:       context (void *)         -> Wird unverändert an 'function' übergeben
+ *
+ * Rückgabewert:    Gibt eine 0 zurück, wenn alle Aufgaben bearbeitet wurden, andernfalls eine 1 (nicht genug Speicher)
+ *
+ * Beschreibung:    Verteilt die Aufgaben zunächst in gleich großen Blöcken auf die Threads und gleicht Ungleichgewichte
+ *                  durch Work-Stealing aus. Kehrt erst zurück, wenn alle Aufgaben bearbeitet sind.
+ */
+int runTasks(long long taskCount, int threadCount, taskFunction function, void *context) {
+    struct threadPool pool;
+    struct poolWorker *workers;
+    pthread_t *threads;
+    long long start;
+    int i, started;
+
+    if (threadCount < 1) {
+        threadCount = 1;
+    }
+
+    pool.threadCount = threadCount;
+    pool.function = function;
+    pool.context = context;
+    pool.queues = malloc(sizeof(*pool.queues) * threadCount);
+    workers = malloc(sizeof(*workers) * threadCount);
+    threads = malloc(sizeof(*threads) * threadCount);
+
+    if (pool.queues == NULL || workers == NULL || threads == NULL) {
+        free(pool.queues);
+        free(workers);
+        free(threads);
+        return 1;
+    }
+
+    start = 0;
+
+    for (i = 0; i < threadCount; i++) {
+        pthread_mutex_init(&pool.queues[i].lock, NULL);
+        pool.queues[i].head = start;
+        start += taskCount / threadCount + (i < taskCount % threadCount ? 1 : 0);
+        pool.queues[i].tail = start;
+        workers[i].pool = &pool;
+        workers[i].index = i;
+    }
+
+    // Thread 0 ist der aufrufende Thread
+    for (started = 1; started < threadCount; started++) {
+        if (pthread_create(&threads[started], NULL, runWorker, &workers[started]) != 0) {
+            break;
+        }
+    }
+
+    // Fehlende Threads sind unkritisch, ihre Aufgaben werden von den anderen gestohlen
+    runWorker(&workers[0]);
+
+    for (i = 1; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (i = 0; i < threadCount; i++) {
+        pthread_mutex_destroy(&pool.queues[i].lock);
+    }
+
+    free(pool.queues);
+    free(workers);
+    free(threads);
+
+    return 0;
+}
+
+/**
+ * Funktion:        getProcessorCount
+ *
+ * Rückgabewert:    Gibt die Anzahl der verfügbaren Prozessorkerne zurück (mindestens 1)
+ *
+ * Beschreibung:    Standardwert für die Anzahl der Threads.
+ */
+int getProcessorCount() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return count > 0 ? (int) count : 1;
+#endif
+}
@@ -0,0 +1,118 @@
+#include "../header/sudokuCore.h"
+
+/**
+ * Funktion:        getRandomLineMap
+ *
+ * Parameter:       lineMap (int[SIZE])      -> Enthält nach dem Funktionsaufruf die Zuordnung Zeile (bzw. Spalte) -> Quellzeile
+ * Parameter:       random (struct random *) -> Zufallsgenerator
+ *
+ * Beschreibung:    Zieht eine zufällige Permutation der Bänder (Gruppen von BOX_SIZE Zeilen) und der Zeilen innerhalb jedes Bandes.
+ *                  Das sind alle Zeilenvertauschungen, die ein gültiges Sudoku gültig lassen (bei 9x9 6^4 Möglichkeiten).
+ */
+static void getRandomLineMap(int lineMap[SIZE], struct random *random) {
+    int groups[BOX_SIZE], lines[BOX_SIZE], i, j;
+
+    for (i = 0; i < BOX_SIZE; i++) {
+        groups[i] = i;
+    }
+
+    shuffle(groups, BOX_SIZE, random);
+
+    for (i = 0; i < BOX_SIZE; i++) {
+        for (j = 0; j < BOX_SIZE; j++) {
+            lines[j] = j;
+        }
+
+        shuffle(lines, BOX_SIZE, random);
+
+        for (j = 0; j < BOX_SIZE; j++) {
+            lineMap[i * BOX_SIZE + j] = groups[i] * BOX_SIZE + lines[j];
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        getRandomTransform
+ *
+ * Parameter:       transform (struct transform *) -> Enthält nach dem Funktionsaufruf die Transformation
+ * Parameter:       random (struct random *)       -> Zufallsgenerator
+ *
+ * Beschreibung:    Zieht ein gleichverteiltes Element der Symmetriegruppe: Umbenennung der Ziffern, Vertauschung von Zeilen
+ *                  innerhalb der Bänder und der Bänder selbst, dasselbe für Spalten, sowie Spiegelung an der
+ *                  Diagonalen (bei 9x9 9! * 6^8 * 2 Elemente). Das Ergebnis wird als Tabelle abgelegt und mit 'applyTransform'
+ *                  in einem Durchlauf über alle Felder angewendet.
+ */
+void getRandomTransform(struct transform *transform, struct random *random) {
+    int rowMap[SIZE], columnMap[SIZE], digits[SIZE], row, column, sourceRow, sourceColumn, transpose, i;
+
+    getRandomLineMap(rowMap, random);
+    getRandomLineMap(columnMap, random);
+    transpose = getRandomBelow(random, 2);
+
+    for (i = 0; i < SIZE; i++) {
+        digits[i] = i + 1;
+    }
+
+    shuffle(digits, SIZE, random);
+    transform->digitMap[0] = 0;
+
+    for (i = 0; i < SIZE; i++) {
+        transform->digitMap[i + 1] = (uint8_t) digits[i];
+    }
+
+    for (row = 0; row < SIZE; row++) {
+        for (column = 0; column < SIZE; column++) {
+            sourceRow = rowMap[row];
+            sourceColumn = columnMap[column];
+
+            transform->cellMap[row * SIZE + column] = (cellIndex) (transpose ? sourceColumn * SIZE + sourceRow : sourceRow * SIZE + sourceColumn);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        applyTransform
+ *
+ * Parameter:       transform (const struct transform *) -> Transformation
+ * Parameter:       source (const uint8_t[GRID_CELLS])   -> Flaches Sudoku-Gitter (zeilenweise, 0 = leer)
+ * Parameter:       target (uint8_t[GRID_CELLS])         -> Enthält nach dem Funktionsaufruf das transformierte Gitter
+ *
+ * Beschreibung:    Wendet eine Transformation an. Aus einem gültigen (bzw. eindeutig lösbaren) Gitter entsteht wieder ein gültiges
+ *                  (bzw. eindeutig lösbares) Gitter. 'source' und 'target' dürfen nicht derselbe Speicher sein.
+ */
+void applyTransform(const struct transform *transform, const uint8_t source[GRID_CELLS], uint8_t target[GRID_CELLS]) {
+    int i;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        target[i] = transform->digitMap[source[transform->cellMap[i]]];
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        transformSudoku
+ *
+ * Parameter:       transform (const struct transform *) -> Transformation
+ * Parameter:       sudokuGrid (struct sudoku)           -> Sudoku
+ *
+ * Rückgabewert:    Gibt das transformierte Sudoku zurück
+ *
+ * Beschreibung:    Gegenstück zu 'applyTransform' für die Struktur 'sudoku'. Vorgegebene Felder wandern mit ihren Werten mit.
+ */
+struct sudoku transformSudoku(const struct transform *transform, struct sudoku sudokuGrid) {
+    struct sudoku result;
+    int i, source;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        source = transform->cellMap[i];
+        result.value[i / SIZE][i % SIZE] = transform->digitMap[sudokuGrid.value[source / SIZE][source % SIZE]];
+        result.generated[i / SIZE][i % SIZE] = sudokuGrid.generated[source / SIZE][source % SIZE];
+    }
+
+    return result;
+}
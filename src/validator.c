@@ -0,0 +1,380 @@
+#include "../header/sudokuCore.h"
+#include <stdatomic.h>
+
+// Die SIMD-Varianten sind auf 9 Felder je Zeile zugeschnitten, andere Größen prüfen skalar
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && BOX_SIZE == 3
+#define VALIDATOR_X86
+#include <immintrin.h>
+#endif
+
+// Anzahl Bytes, die die SIMD-Varianten ab Gitteranfang lesen (letzte Zeile ab Byte 72 plus 16 Bytes)
+#define GRID_READ_SIZE 88
+
+// Signatur einer Batch-Implementierung
+typedef void (*batchFunction)(const uint8_t *grids, size_t n, uint8_t *results);
+
+// Batch-Implementierung mit ihrem Namen (Funktion und Name werden immer zusammen gewählt)
+struct batchVariant {
+    batchFunction function;
+    const char *name;
+};
+
+/**
+ * Funktion:        checkGrid
+ *
+ * Parameter:       grid (const uint8_t[GRID_CELLS]) -> Flaches Sudoku-Gitter (zeilenweise)
+ *
+ * Rückgabewert:    Gibt eine 0 für falsch zurück und eine 1 für korrekt
+ *
+ * Beschreibung:    Skalare Prüfung eines vollständig ausgefüllten Sudokus über Bitmasken je Zeile, Spalte und Block.
+ */
+int checkGrid(const uint8_t grid[GRID_CELLS]) {
+    digitMask rows[SIZE] = {0}, columns[SIZE] = {0}, boxes[SIZE] = {0};
+    digitMask bit;
+    int cell;
+
+    INSTRUMENT_COUNT(COUNTER_BOARD_SCANS, 1);
+
+    for (cell = 0; cell < GRID_CELLS; cell++) {
+        if (grid[cell] < 1 || grid[cell] > SIZE) {
+            return 0;
+        }
+
+        bit = (digitMask) ((digitMask) 1 << (grid[cell] - 1));
+
+        // Jede Ziffer darf je Einheit nur einmal vorkommen. Bei SIZE Feldern je Einheit ist diese dann vollständig.
+        if ((rows[rowOf[cell]] | columns[columnOf[cell]] | boxes[boxOf[cell]]) & bit) {
+            return 0;
+        }
+
+        rows[rowOf[cell]] |= bit;
+        columns[columnOf[cell]] |= bit;
+        boxes[boxOf[cell]] |= bit;
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        checkBatchScalar
+ *
+ * Parameter:       grids (const uint8_t *) -> n Gitter mit je GRID_CELLS Bytes
+ * Parameter:       n (size_t)              -> Anzahl der Gitter
+ * Parameter:       results (uint8_t *)     -> Enthält danach je Gitter 1 = korrekt, 0 = falsch
+ *
+ * Beschreibung:    Fallback ohne SIMD-Befehle.
+ */
+static void checkBatchScalar(const uint8_t *grids, size_t n, uint8_t *results) {
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        results[i] = (uint8_t) checkGrid(grids + i * GRID_CELLS);
+    }
+
+    return;
+}
+
+#ifdef VALIDATOR_X86
+
+/**
+ * Funktion:        checkGridSse
+ *
+ * Parameter:       grid (const uint8_t *) -> Gitter, ab dem mindestens 88 Bytes lesbar sind
+ *
+ * Rückgabewert:    Gibt eine 0 für falsch zurück und eine 1 für korrekt
+ *
+ * Beschreibung:    Prüft alle 27 Einheiten mit SSE4.1. Jede Zeile wird in ein Register geladen und über eine Tabelle (pshufb)
+ *                  in Bitmasken übersetzt: 'lo' enthält die Ziffern 1 - 8 als Bit, 'hi' die Ziffer 9. Spalten entstehen durch
+ *                  vertikales ODER der Zeilen, Blöcke und Zeilen durch horizontales ODER über verschobene Register.
+ *                  Eine Einheit ist korrekt, wenn ihr ODER alle 9 Ziffern enthält (9 Felder, 9 verschiedene Ziffern).
+ */
+__attribute__((target("sse4.1")))
+static int checkGridSse(const uint8_t *grid) {
+    const __m128i lutLo = _mm_setr_epi8(0, 1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i lutHi = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0);
+    const __m128i limit = _mm_set1_epi8(10);
+    __m128i value, lo, hi, tLo, tHi;
+    __m128i columnLo, columnHi, bandLo, bandHi, rowLo, rowHi, boxLo, boxHi;
+    int row, columns, rows, boxes;
+
+    columnLo = columnHi = bandLo = bandHi = _mm_setzero_si128();
+    rowLo = rowHi = boxLo = boxHi = _mm_set1_epi8(-1);
+
+    for (row = 0; row < SIZE; row++) {
+        // Werte über 9 auf 10 begrenzen, damit die Tabelle für sie keine Ziffer liefert
+        value = _mm_min_epu8(_mm_loadu_si128((const __m128i *) (grid + row * SIZE)), limit);
+        lo = _mm_shuffle_epi8(lutLo, value);
+        hi = _mm_shuffle_epi8(lutHi, value);
+
+        columnLo = _mm_or_si128(columnLo, lo);
+        columnHi = _mm_or_si128(columnHi, hi);
+        bandLo = _mm_or_si128(bandLo, lo);
+        bandHi = _mm_or_si128(bandHi, hi);
+
+        // Zeile: Dreiergruppen (Lanes 0, 3, 6) und danach alle 9 Lanes in Lane 0 zusammenfassen
+        tLo = _mm_or_si128(lo, _mm_or_si128(_mm_srli_si128(lo, 1), _mm_srli_si128(lo, 2)));
+        tHi = _mm_or_si128(hi, _mm_or_si128(_mm_srli_si128(hi, 1), _mm_srli_si128(hi, 2)));
+        tLo = _mm_or_si128(tLo, _mm_or_si128(_mm_srli_si128(tLo, 3), _mm_srli_si128(tLo, 6)));
+        tHi = _mm_or_si128(tHi, _mm_or_si128(_mm_srli_si128(tHi, 3), _mm_srli_si128(tHi, 6)));
+        rowLo = _mm_and_si128(rowLo, tLo);
+        rowHi = _mm_and_si128(rowHi, tHi);
+
+        // Nach drei Zeilen liegen die drei Blöcke des Bandes in den Lanes 0, 3 und 6
+        if (row % 3 == 2) {
+            tLo = _mm_or_si128(bandLo, _mm_or_si128(_mm_srli_si128(bandLo, 1), _mm_srli_si128(bandLo, 2)));
+            tHi = _mm_or_si128(bandHi, _mm_or_si128(_mm_srli_si128(bandHi, 1), _mm_srli_si128(bandHi, 2)));
+            boxLo = _mm_and_si128(boxLo, tLo);
+            boxHi = _mm_and_si128(boxHi, tHi);
+            bandLo = bandHi = _mm_setzero_si128();
+        }
+    }
+
+    columns = _mm_movemask_epi8(_mm_cmpeq_epi8(columnLo, _mm_set1_epi8(-1))) & _mm_movemask_epi8(_mm_cmpeq_epi8(columnHi, _mm_set1_epi8(1)));
+    rows = _mm_movemask_epi8(_mm_cmpeq_epi8(rowLo, _mm_set1_epi8(-1))) & _mm_movemask_epi8(_mm_cmpeq_epi8(rowHi, _mm_set1_epi8(1)));
+    boxes = _mm_movemask_epi8(_mm_cmpeq_epi8(boxLo, _mm_set1_epi8(-1))) & _mm_movemask_epi8(_mm_cmpeq_epi8(boxHi, _mm_set1_epi8(1)));
+
+    return (columns & 0x1FF) == 0x1FF && (rows & 0x1) && (boxes & 0x49) == 0x49;
+}
+
+/**
+ * Funktion:        checkBatchSse
+ *
+ * Parameter:       grids (const uint8_t *) -> n Gitter mit je GRID_CELLS Bytes
+ * Parameter:       n (size_t)              -> Anzahl der Gitter
+ * Parameter:       results (uint8_t *)     -> Enthält danach je Gitter 1 = korrekt, 0 = falsch
+ *
+ * Beschreibung:    SSE4.1-Variante. Das letzte Gitter wird in einen Puffer kopiert, damit nicht über das Array hinaus gelesen wird.
+ */
+__attribute__((target("sse4.1")))
+static void checkBatchSse(const uint8_t *grids, size_t n, uint8_t *results) {
+    uint8_t padded[GRID_READ_SIZE] = {0};
+    size_t i;
+
+    for (i = 0; i + 1 < n; i++) {
+        results[i] = (uint8_t) checkGridSse(grids + i * GRID_CELLS);
+    }
+
+    if (n > 0) {
+        memcpy(padded, grids + (n - 1) * GRID_CELLS, GRID_CELLS);
+        results[n - 1] = (uint8_t) checkGridSse(padded);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        loadRowPair
+ *
+ * Parameter:       first (const uint8_t *)  -> Zeile im ersten Gitter
+ * Parameter:       second (const uint8_t *) -> Zeile im zweiten Gitter
+ *
+ * Rückgabewert:    Gibt ein AVX2-Register mit der ersten Zeile in der unteren und der zweiten Zeile in der oberen Hälfte zurück
+ *
+ * Beschreibung:    Lädt dieselbe Zeile zweier Gitter in ein Register.
+ */
+__attribute__((target("avx2")))
+static __m256i loadRowPair(const uint8_t *first, const uint8_t *second) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) first)), _mm_loadu_si128((const __m128i *) second), 1);
+}
+
+/**
+ * Funktion:        checkGridPairAvx2
+ *
+ * Parameter:       first (const uint8_t *)  -> Erstes Gitter, ab dem mindestens 88 Bytes lesbar sind
+ * Parameter:       second (const uint8_t *) -> Zweites Gitter, ab dem mindestens 88 Bytes lesbar sind
+ *
+ * Rückgabewert:    Gibt in Bit 0 das Ergebnis des ersten und in Bit 1 das Ergebnis des zweiten Gitters zurück
+ *
+ * Beschreibung:    Gleiches Verfahren wie 'checkGridSse', aber für zwei Gitter je Befehl (AVX2 arbeitet je 128-Bit-Hälfte getrennt).
+ */
+__attribute__((target("avx2")))
+static int checkGridPairAvx2(const uint8_t *first, const uint8_t *second) {
+    const __m256i lutLo = _mm256_setr_epi8(0, 1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i lutHi = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+                                           0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0);
+    const __m256i limit = _mm256_set1_epi8(10);
+    __m256i value, lo, hi, tLo, tHi;
+    __m256i columnLo, columnHi, bandLo, bandHi, rowLo, rowHi, boxLo, boxHi;
+    unsigned int columns, rows, boxes, result;
+    int row;
+
+    columnLo = columnHi = bandLo = bandHi = _mm256_setzero_si256();
+    rowLo = rowHi = boxLo = boxHi = _mm256_set1_epi8(-1);
+
+    for (row = 0; row < SIZE; row++) {
+        value = _mm256_min_epu8(loadRowPair(first + row * SIZE, second + row * SIZE), limit);
+        lo = _mm256_shuffle_epi8(lutLo, value);
+        hi = _mm256_shuffle_epi8(lutHi, value);
+
+        columnLo = _mm256_or_si256(columnLo, lo);
+        columnHi = _mm256_or_si256(columnHi, hi);
+        bandLo = _mm256_or_si256(bandLo, lo);
+        bandHi = _mm256_or_si256(bandHi, hi);
+
+        tLo = _mm256_or_si256(lo, _mm256_or_si256(_mm256_srli_si256(lo, 1), _mm256_srli_si256(lo, 2)));
+        tHi = _mm256_or_si256(hi, _mm256_or_si256(_mm256_srli_si256(hi, 1), _mm256_srli_si256(hi, 2)));
+        tLo = _mm256_or_si256(tLo, _mm256_or_si256(_mm256_srli_si256(tLo, 3), _mm256_srli_si256(tLo, 6)));
+        tHi = _mm256_or_si256(tHi, _mm256_or_si256(_mm256_srli_si256(tHi, 3), _mm256_srli_si256(tHi, 6)));
+        rowLo = _mm256_and_si256(rowLo, tLo);
+        rowHi = _mm256_and_si256(rowHi, tHi);
+
+        if (row % 3 == 2) {
+            tLo = _mm256_or_si256(bandLo, _mm256_or_si256(_mm256_srli_si256(bandLo, 1), _mm256_srli_si256(bandLo, 2)));
+            tHi = _mm256_or_si256(bandHi, _mm256_or_si256(_mm256_srli_si256(bandHi, 1), _mm256_srli_si256(bandHi, 2)));
+            boxLo = _mm256_and_si256(boxLo, tLo);
+            boxHi = _mm256_and_si256(boxHi, tHi);
+            bandLo = bandHi = _mm256_setzero_si256();
+        }
+    }
+
+    columns = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(columnLo, _mm256_set1_epi8(-1)))
+            & (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(columnHi, _mm256_set1_epi8(1)));
+    rows = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(rowLo, _mm256_set1_epi8(-1)))
+         & (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(rowHi, _mm256_set1_epi8(1)));
+    boxes = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(boxLo, _mm256_set1_epi8(-1)))
+          & (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(boxHi, _mm256_set1_epi8(1)));
+
+    result = 0;
+
+    if ((columns & 0x1FF) == 0x1FF && (rows & 0x1) && (boxes & 0x49) == 0x49) {
+        result |= 1;
+    }
+
+    if (((columns >> 16) & 0x1FF) == 0x1FF && ((rows >> 16) & 0x1) && ((boxes >> 16) & 0x49) == 0x49) {
+        result |= 2;
+    }
+
+    return (int) result;
+}
+
+/**
+ * Funktion:        checkBatchAvx2
+ *
+ * Parameter:       grids (const uint8_t *) -> n Gitter mit je GRID_CELLS Bytes
+ * Parameter:       n (size_t)              -> Anzahl der Gitter
+ * Parameter:       results (uint8_t *)     -> Enthält danach je Gitter 1 = korrekt, 0 = falsch
+ *
+ * Beschreibung:    AVX2-Variante, prüft jeweils zwei Gitter gleichzeitig. Die letzten Gitter laufen über einen Puffer.
+ */
+__attribute__((target("avx2")))
+static void checkBatchAvx2(const uint8_t *grids, size_t n, uint8_t *results) {
+    uint8_t padded[2][GRID_READ_SIZE] = {{0}};
+    size_t i;
+    int result;
+
+    // Das zweite Gitter eines Paares darf nicht das letzte im Array sein
+    for (i = 0; i + 2 < n; i += 2) {
+        result = checkGridPairAvx2(grids + i * GRID_CELLS, grids + (i + 1) * GRID_CELLS);
+        results[i] = (uint8_t) (result & 1);
+        results[i + 1] = (uint8_t) (result >> 1);
+    }
+
+    if (i < n) {
+        memcpy(padded[0], grids + i * GRID_CELLS, GRID_CELLS);
+
+        if (i + 1 < n) {
+            memcpy(padded[1], grids + (i + 1) * GRID_CELLS, GRID_CELLS);
+        }
+
+        result = checkGridPairAvx2(padded[0], padded[1]);
+        results[i] = (uint8_t) (result & 1);
+
+        if (i + 1 < n) {
+            results[i + 1] = (uint8_t) (result >> 1);
+        }
+    }
+
+    return;
+}
+
+#endif // VALIDATOR_X86
+
+/**
+ * Funktion:        selectBatchVariant
+ *
+ * Rückgabewert:    Gibt die schnellste auf dieser CPU verfügbare Variante zurück
+ *
+ * Beschreibung:    Wählt zur Laufzeit zwischen AVX2, SSE4.1 und der skalaren Variante.
+ */
+static const struct batchVariant *selectBatchVariant() {
+    static const struct batchVariant scalar = { checkBatchScalar, "scalar" };
+#ifdef VALIDATOR_X86
+    static const struct batchVariant avx2 = { checkBatchAvx2, "avx2" }, sse = { checkBatchSse, "sse4.1" };
+
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return &avx2;
+    }
+
+    if (__builtin_cpu_supports("sse4.1")) {
+        return &sse;
+    }
+#endif
+
+    return &scalar;
+}
+
+// Gewählte Variante. Ein einziger atomarer Zeiger: Jeder Thread sieht Funktion und Name entweder gar nicht oder
+// beide vollständig. Gleichzeitige Erstaufrufe wählen dieselbe Variante.
+static _Atomic(const struct batchVariant *) selectedVariant;
+
+/**
+ * Funktion:        getBatchVariant
+ *
+ * Rückgabewert:    Gibt die gewählte Variante zurück (wird beim ersten Aufruf bestimmt)
+ */
+static const struct batchVariant *getBatchVariant() {
+    const struct batchVariant *variant;
+
+    variant = atomic_load_explicit(&selectedVariant, memory_order_acquire);
+
+    if (variant == NULL) {
+        variant = selectBatchVariant();
+        atomic_store_explicit(&selectedVariant, variant, memory_order_release);
+    }
+
+    return variant;
+}
+
+/**
+ * Funktion:        checkSudokuBatch
+ *
+ * Parameter:       grids (const uint8_t *) -> n Gitter mit je GRID_CELLS Bytes (zeilenweise, Werte 1 - SIZE)
+ * Parameter:       n (size_t)              -> Anzahl der Gitter
+ * Parameter:       results (uint8_t *)     -> Enthält nach dem Funktionsaufruf je Gitter 1 = korrekt gelöst, 0 = falsch
+ *
+ * Rückgabewert:    Gibt die Anzahl der korrekt gelösten Gitter zurück
+ *
+ * Beschreibung:    Prüft viele vollständig ausgefüllte Sudokus auf einmal (Gegenstück zu 'checkSudoku' für große Mengen).
+ */
+size_t checkSudokuBatch(const uint8_t *grids, size_t n, uint8_t *results) {
+    size_t i, valid;
+
+    INSTRUMENT_BEGIN(TIMER_VALIDATE);
+    INSTRUMENT_COUNT(COUNTER_BOARD_SCANS, n);
+
+    getBatchVariant()->function(grids, n, results);
+
+    valid = 0;
+
+    for (i = 0; i < n; i++) {
+        valid += results[i];
+    }
+
+    INSTRUMENT_END(TIMER_VALIDATE);
+
+    return valid;
+}
+
+/**
+ * Funktion:        getValidatorName
+ *
+ * Rückgabewert:    Gibt den Namen der verwendeten Variante zurück ("avx2", "sse4.1" oder "scalar")
+ *
+ * Beschreibung:    Für Ausgaben in Benchmarks und Werkzeugen.
+ */
+const char *getValidatorName() {
+    return getBatchVariant()->name;
+}
@@ -26,6 +26,9 @@ int showView(int view) {
         case VIEW_GAME_READ:
             return viewGameReadFromSudokuFile();
 
+        case VIEW_GAME_RECOVER:
+            return viewGameRecover();
+
         default:
             return VIEW_EXIT;
     }
@@ -45,7 +48,7 @@ int viewHome() {
 
     // Wiederholt die Anzeige des Startbilschirms so oft, bis eine g�ltige Eingabe erfolgt ist
     do {
-        system("cls");
+        clearScreen();
         printf("SKRAM Sudoku\n");
         printf("\n");
         printf("[1] Neues Spiel\n");
@@ -106,7 +109,7 @@ int viewGameNew() {
 
     // Wiederholt die Anzeige des Bildschirms f�r ein neues Spiel so oft, bis eine g�ltige Eingabe erfolgt ist
     do {
-        system("cls");
+        clearScreen();
         printf("SKRAM Sudoku\n");
         printf("\n");
         printf("Neues Spiel\n");
@@ -151,186 +154,258 @@ int viewGameNew() {
     // Neues Sudoku nach Schwierigkeitsgrad generieren
     struct savegame sudoku;
 
-    sudoku.sudokuGridSolved = generateFullSudoku();
-    sudoku.sudokuGrid = makeSodukoPlayable(sudoku.sudokuGridSolved, difficulty);
-    sudoku.pastTime = 0.0;
+    // Fertiges Sudoku aus dem Vorrat nehmen, nur bei leerem Vorrat sofort generieren. Die Bewertung nach Lösungstechniken
+    // übernimmt der Vorrat im Hintergrund, hier wird ohne Wartezeit nur nach Anzahl leerer Felder ausgedünnt.
+    if (!takePooledPuzzle(difficulty, &sudoku)) {
+        sudoku.sudokuGridSolved = generateFullSudoku(getSessionRandom(), DEFAULT_GENERATOR);
+        sudoku.sudokuGrid = makeSodukoPlayableUnique(sudoku.sudokuGridSolved, difficulty, getSessionRandom());
+        sudoku.pastTime = 0.0;
+        sudoku.difficulty = difficulty;
+    }
 
     // Generiertes Sudoku an den Play-View weitergeben und dessen R�ckgabewert zur�ckgeben
-    return viewGamePlay(sudoku);
+    return viewGamePlay(sudoku, NULL);
+}
+
+/**
+ * Funktion:        printSavegameList
+ *
+ * Parameter:       store (const struct saveStore *) -> Geöffnete Spielstand-Datei
+ * Parameter:       suffix (const char *)            -> Text, der hinter jedem Spielstand ausgegeben wird
+ *
+ * Beschreibung:    Listet alle Spielstände mit Schwierigkeitsgrad, Fortschritt und Zeit aus dem Index auf.
+ */
+static void printSavegameList(const struct saveStore *store, const char *suffix) {
+    static const char *difficultyNames[4] = { "-", "Leicht", "Mittel", "Schwer" };
+    const struct saveEntry *entry;
+    struct time pastTime;
+    int i;
+
+    if (store->count == 0) {
+        printf("Keine Spielstaende vorhanden\n");
+    }
+
+    for (i = 0; i < store->count; i++) {
+        entry = &store->entries[i];
+        pastTime = getPastTime(entry->pastTime / 1000.0);
+
+        printf("[%d] %-39s %-6s %3d%% %02d:%02d:%02d%s\n", i + 1, entry->name,
+               difficultyNames[entry->difficulty >= EASY && entry->difficulty <= DIFFICULT ? entry->difficulty : 0],
+               entry->progress, pastTime.hours, pastTime.minutes, pastTime.seconds, suffix);
+    }
+
+    return;
 }
 
 /**
  * Funktion:        viewGameLoad
  *
- * R�ckgabewert:    Gibt VIEW_HOME zur�ck
+ * Rückgabewert:    Gibt VIEW_HOME zurück
  *
  * Beschreibung:    Zeigt den Bildschirm an, um ein Spiel zu laden.
  */
 int viewGameLoad() {
-    int i, input, deletedSlot, errorInput, noSavegame;
+    struct saveStore store;
+    struct savegame sudoku;
+    struct journal journal;
+    int input, deleted, errorInput, errorFile;
     char inputString[STRLEN];
-    deletedSlot = 0;
+    deleted = 0;
     errorInput = 0;
-    noSavegame = 0;
+    errorFile = 0;
+    initJournal(&journal);
 
-    // Wiederholt die Anzeige des Bildschirms um ein gespeichertes Spiel zu laden so oft, bis eine g�ltige Eingabe erfolgt ist
+    if (!openSaveStore(&store)) {
+        // Darf nicht auftreten
+        die();
+    }
+
+    // Wiederholt die Anzeige des Bildschirms um ein gespeichertes Spiel zu laden so oft, bis eine gültige Eingabe erfolgt ist
     do {
-        system("cls");
+        clearScreen();
         printf("SKRAM Sudoku\n");
         printf("\n");
         printf("Spielstand laden\n");
 
-        // Listet Spielst�nde 1 - 10 (0 - 9)
-        for (i = 1; i <= 10; i++) {
-            if (checkSavegameSlot(i)) {
-                printf("[%d] Spielstand %d\n", i, i);
-            } else {
-                printf("[%d] Nicht vorhanden\n", i);
-            }
-        }
+        printSavegameList(&store, "");
 
         printf("\n");
-        printf("[11] Spielstand loeschen\n");
-        printf("[12] Zurueck zum Startbildschirm\n");
+        printf("[%d] Spielstand loeschen\n", store.count + 1);
+        printf("[%d] Zurueck zum Startbildschirm\n", store.count + 2);
         printf("\n");
 
-        if (deletedSlot > 0) {
-        	printf("Spielstand %d wurde erfolgreich geloescht!\n", deletedSlot);
-        	deletedSlot = 0;
-        } else {
-        	if (errorInput == 1) {
-        	    printf("Die Eingabe war Fehlerhaft, bitte erneut eingeben!\n");
-        	} else {
-        	    if (noSavegame == 1) {
-        	        printf("Dieser Spielstand ist nicht vorhanden!\n");
-        	    }
-        	}
+        if (deleted) {
+            printf("Der Spielstand wurde erfolgreich geloescht!\n");
+            deleted = 0;
+        } else if (errorFile) {
+            printf("Dieser Spielstand ist beschaedigt!\n");
+        } else if (errorInput) {
+            printf("Die Eingabe war Fehlerhaft, bitte erneut eingeben!\n");
         }
 
         printf("Eingabe: ");
         readLine(inputString);
         input = checkAndConvertInputToInt(inputString);
+        errorInput = 0;
+        errorFile = 0;
 
-        // Bei der Eingabe 11 soll ein Spielstand gel�scht werden
-        if (input == 11) {
-        	deletedSlot = viewGameDelete();
-        	continue;
+        // Spielstand löschen
+        if (input == store.count + 1) {
+            deleted = viewGameDelete(&store);
+            continue;
         }
 
-        // Bei der Eingabe 12 soll zum Startbildschirm gewechselt werden
-        if (input == 12) {
+        // Zurück zum Startbildschirm
+        if (input == store.count + 2) {
+            closeSaveStore(&store);
+            freeJournal(&journal);
             return VIEW_HOME;
         }
 
-        if (input < 1 || input > 10) {
+        if (input < 1 || input > store.count) {
             errorInput = 1;
-        } else {
-            errorInput = 0;
-        }
-
-        // Pr�ft, ob ausgew�hlter Spielstand verf�gbar ist
-        if (!checkSavegameSlot(input)) {
-            noSavegame = 1;
+        } else if (!readStoredSave(&store, input - 1, &sudoku, &journal)) {
+            errorFile = 1;
+            input = 0;
         }
-    } while (input < 1 || input > 10 || !checkSavegameSlot(input));
-
-    // Definiert das Sudoku und liest es aus dem Spielstand ein
-    struct savegame sudoku;
-    int error;
+    } while (input < 1 || input > store.count);
 
-    sudoku = readSavegame(input, &error);
+    closeSaveStore(&store);
 
-    if (error != 0) {
-        // Darf nicht auftreten
-        die();
-    }
-
-    // Aus dem Speicherstand gelesenes Sudoku an den Play-View weitergeben und dessen R�ckgabewert zur�ckgeben
-    return viewGamePlay(sudoku);
+    // Aus dem Speicherstand gelesenes Sudoku samt Zugverlauf an den Play-View weitergeben und dessen Rückgabewert zurückgeben
+    return viewGamePlay(sudoku, &journal);
 }
 
 /**
  * Funktion:        viewGameDelete
  *
- * R�ckgabewert:    Gibt die Slotnummer des gel�schten Spielstandes zur�ck
+ * Parameter:       store (struct saveStore *) -> Geöffnete Spielstand-Datei
  *
- * Beschreibung:    Zeigt den Bildschirm an, um ein Spiel zu l�schen.
+ * Rückgabewert:    Gibt eine 1 zurück, wenn ein Spielstand gelöscht wurde, andernfalls eine 0
+ *
+ * Beschreibung:    Zeigt den Bildschirm an, um ein Spiel zu löschen.
  */
-int viewGameDelete () {
-	int i, input, errorInput, noSavegame;
+int viewGameDelete(struct saveStore *store) {
+    int input, errorInput;
     char inputString[STRLEN];
     errorInput = 0;
-    noSavegame = 0;
 
-    // Wiederholt die Anzeige des Bildschirms um ein gespeichertes Spiel zu loeschen so oft, bis eine g�ltige Eingabe erfolgt ist
+    // Wiederholt die Anzeige des Bildschirms um ein gespeichertes Spiel zu loeschen so oft, bis eine gültige Eingabe erfolgt ist
     do {
-        system("cls");
+        clearScreen();
         printf("SKRAM Sudoku\n");
         printf("\n");
         printf("Spielstand loeschen\n");
 
-        // Listet Spielst�nde 1 - 10 (0 - 9)
-        for (i = 1; i <= 10; i++) {
-            if (checkSavegameSlot(i)) {
-                printf("[%d] Spielstand %d\n", i, i);
-            } else {
-                printf("[%d] Nicht vorhanden\n", i);
-            }
-        }
+        printSavegameList(store, "");
 
         printf("\n");
-        printf("[11] Abbrechen\n");
+        printf("[%d] Abbrechen\n", store->count + 1);
         printf("\n");
 
         if (errorInput == 1) {
             printf("Die Eingabe war Fehlerhaft, bitte erneut eingeben!\n");
-        } else {
-            if (noSavegame == 1) {
-                printf("Dieser Spielstand ist nicht vorhanden!\n");
-            }
         }
 
         printf("Eingabe: ");
         readLine(inputString);
         input = checkAndConvertInputToInt(inputString);
 
-        // Bei der Eingabe 11 soll abgebrochen
-        if (input == 11) {
-        	return 0;
+        // Abbrechen
+        if (input == store->count + 1) {
+            return 0;
         }
 
-        if (input < 1 || input > 10) {
+        if (input < 1 || input > store->count) {
             errorInput = 1;
         } else {
             errorInput = 0;
         }
+    } while (input < 1 || input > store->count);
+
+    // Spielstand löschen
+    if (!deleteStoredSave(store, input - 1)) {
+        // Darf nicht auftreten
+        die();
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        viewGameRecover
+ *
+ * Rückgabewert:    Gibt VIEW_HOME zurück
+ *
+ * Beschreibung:    Bietet beim Start an, ein nicht beendetes Spiel aus der automatischen Sicherung fortzusetzen (z.B. nach
+ *                  einem Absturz). Gibt es keine Sicherung, wird direkt der Startbildschirm angezeigt.
+ */
+int viewGameRecover() {
+    struct savegame sudoku;
+    struct journal journal;
+    struct time pastTime;
+    int input, errorInput;
+    char inputString[STRLEN];
+    errorInput = 0;
+
+    initJournal(&journal);
+
+    if (!recoverAutosave(&sudoku, &journal)) {
+        return VIEW_HOME;
+    }
+
+    pastTime = getPastTime(sudoku.pastTime);
+
+    do {
+        clearScreen();
+        printf("SKRAM Sudoku\n");
+        printf("\n");
+        printf("Das letzte Spiel wurde nicht beendet (bislang benoetigte Zeit: %02d:%02d:%02d).\n", pastTime.hours,
+               pastTime.minutes, pastTime.seconds);
+        printf("[1] Spiel fortsetzen\n");
+        printf("[2] Spiel verwerfen\n");
+        printf("\n");
 
-        // Pr�ft, ob ausgew�hlter Spielstand verf�gbar ist
-        if (!checkSavegameSlot(input)) {
-            noSavegame = 1;
+        if (errorInput == 1) {
+            printf("Die Eingabe war Fehlerhaft, bitte erneut eingeben!\n");
         }
-    } while (input < 1 || input > 10 || !checkSavegameSlot(input));
 
-    // Spielstand l�schen
-    deleteSavegame(input);
+        printf("Eingabe: ");
+        readLine(inputString);
+        input = checkAndConvertInputToInt(inputString);
+        errorInput = input < 1 || input > 2;
+    } while (errorInput);
+
+    if (input == 2) {
+        remove(AUTOSAVE_LOG_FILE);
+        remove(AUTOSAVE_SNAPSHOT_FILE);
+        freeJournal(&journal);
+        return VIEW_HOME;
+    }
 
-    // Nummer des gel��chten Spielstandes zur�ckgeben
-    return input;
+    // Wiederhergestelltes Sudoku samt Zugverlauf an den Play-View weitergeben und dessen Rückgabewert zurückgeben
+    return viewGamePlay(sudoku, &journal);
 }
 
 /**
  * Funktion:        viewGamePlay
  *
  * Parameter:       sudoku (struct savegame) -> Savegame-Struktur, in dem der aktuelle Spielfortschritt, die L�sung und die bislang ben�tigte Zeit enthalten ist
+ * Parameter:       history (struct journal *) -> Zugverlauf des geladenen Spiels (NULL = neues Spiel), wird übernommen und beim Verlassen freigegeben
  *
  * R�ckgabewert:    Gibt VIEW_HOME zur�ck
  *
  * Beschreibung:    Zeigt den Spielbildschirm an.
  */
-int viewGamePlay(struct savegame sudoku) {
+int viewGamePlay(struct savegame sudoku, struct journal *history) {
+    struct game game;
+    struct journal journal;
+    struct autosave autosave;
+    struct gridView view;
     struct field field;
+    struct hint hint;
     struct time pastTime;
-    int errorInput, row, value, column, error, alterError, saved, solved;
+    int errorInput, row, value, column, error, alterError, saved, solved, hinted, undone;
     char inputString[STRLEN];
     double startTime, timeDiff, staticPastTime;
 
@@ -340,35 +415,78 @@ int viewGamePlay(struct savegame sudoku) {
     errorInput = 0;
     alterError = 0;
     saved = 0;
+    solved = 0;
+    hinted = 0;
+    undone = 0;
+
+    // Zugverlauf übernehmen (Undo/Redo ändert nur einzelne Felder und kopiert nie das Spielfeld)
+    if (history != NULL) {
+        journal = *history;
+    } else {
+        initJournal(&journal);
+    }
+
+    // Spielstand mit Konflikt- und Leerfeldzählern aufbauen (wird danach nur noch inkrementell geändert)
+    initGame(&game, &sudoku);
+    view.valid = 0;
+
+    // Jeder Zug wird automatisch gesichert und nach einem Absturz beim nächsten Start wiederhergestellt
+    startAutosave(&autosave, &sudoku, &journal);
 
     // Wiederholt die Anzeige des Spielebildschirms so oft, bis eine g�ltige Eingabe erfolgt ist bzw. das Sudoku gel�st wurde
     do {
-        system("cls");
-        printf("SKRAM Sudoku\n");
-        printf("\n");
-        printf("Das Spiel wird beendet, sobald Sie alle Felder korrekt ausgefuellt haben!\n");
-        printf("Geben Sie folgende Menuecodes bei Zeile ein!\n");
-        printf("[10] Zurueck zum Startbildschirm (Das aktuelle Spiel geht verloren!)\n");
-        printf("[11] Spiel speichern\n");
-        printf("[12] Tipp anzeigen (Befuellt ein zufaellig gewaehltes Feld)\n");
-        printf("\n");
+        // Protokoll der automatischen Sicherung gelegentlich zu einem neuen Abbild zusammenfassen
+        if (needsAutosaveSnapshot(&autosave)) {
+            gameToSavegame(&game, &sudoku);
+            sudoku.pastTime = difftime(time(NULL), (time_t) 0) - startTime + staticPastTime;
+            writeAutosaveSnapshot(&autosave, &sudoku, &journal);
+        }
 
-        // Sudoku in der Konsole darstellen
-        printGrid(sudoku.sudokuGrid);
+        // Kopf und Spielfeld nur beim ersten Mal ganz zeichnen, danach nur geänderte Felder und den Bereich darunter.
+        // Passt der Bildschirm nicht in die Konsole, scrollt sie und es wird jedes Mal ganz neu gezeichnet.
+        if (!view.valid || !fitsScreen(&view, PLAY_STATUS_LINES)) {
+            clearScreen();
+            // Kopf kompakt halten (7 Zeilen): Spielfeld und Eingabebereich müssen ohne Scrollen auf 30 Zeilen passen
+            printf("SKRAM Sudoku\n");
+            printf("Das Spiel wird beendet, sobald Sie alle Felder korrekt ausgefuellt haben!\n");
+            printf("Geben Sie folgende Menuecodes bei Zeile ein!\n");
+            printf("[%d] Zurueck zum Startbildschirm (Das aktuelle Spiel geht verloren!)\n", MENU_CODE_HOME);
+            printf("[%d] Spiel speichern\n", MENU_CODE_SAVE);
+            printf("[%d] Tipp anzeigen (Fuellt das Feld des leichtesten naechsten Schrittes)\n", MENU_CODE_HINT);
+            printf("[%d] Letzten Zug rueckgaengig machen, [%d] Zug wiederholen\n", MENU_CODE_UNDO, MENU_CODE_REDO);
+            drawGrid(&view, &game.board, 8);
+        } else {
+            // Meldungen einzeilig halten: Mehr als PLAY_STATUS_LINES Zeilen würden den Bildschirm scrollen
+            updateGrid(&view, &game.board);
+            moveCursor(view.top + GRID_LINES, 1);
+            fputs(VT_CLEAR_BELOW, stdout);
+        }
 
         printf("\n");
 
         if (saved == 1) {
-            printf("Das Spiel wurde erfolgreich gespeichert!\n\n");
+            printf("Das Spiel wurde erfolgreich gespeichert!\n");
             saved = 0;
         }
 
+        if (hinted == 1) {
+            printf("Tipp: %c%d = %c (%s)\n", 'A' + hint.cell % SIZE, hint.cell / SIZE + 1, valueToChar(hint.value),
+                   hint.technique == TECHNIQUE_NONE ? "aus der Loesung" : getTechniqueName(hint.technique));
+            hinted = 0;
+        } else if (undone == 1) {
+            printf("Es gibt keinen Zug, der rueckgaengig gemacht oder wiederholt werden kann!\n");
+            undone = 0;
+        } else if (hinted == -1) {
+            printf("Kein Tipp moeglich, bitte zuerst widerspruechliche Eintraege korrigieren!\n");
+            hinted = 0;
+        }
+
         if (errorInput == 1) {
-            printf("Die Eingabe war Fehlerhaft, bitte erneut eingeben!\n\n");
+            printf("Die Eingabe war Fehlerhaft, bitte erneut eingeben!\n");
             errorInput = 0;
         } else {
             if (alterError == 1) {
-                printf("Ein vordefiniertes Feld kann nicht geaendert werden!\n\n");
+                printf("Ein vordefiniertes Feld kann nicht geaendert werden!\n");
                 alterError = 0;
             }
         }
@@ -385,19 +503,23 @@ int viewGamePlay(struct savegame sudoku) {
         readLine(inputString);
         row = checkAndConvertInputToInt(inputString);
 
-        // Bei der Eingabe 10 soll zum Startbildschirm zur�ckgekehrt werden
-        if (row == 10) {
+        // Bei der Eingabe MENU_CODE_HOME soll zum Startbildschirm zur�ckgekehrt werden
+        if (row == MENU_CODE_HOME) {
+            stopAutosave(&autosave, 1);
+            freeJournal(&journal);
             return VIEW_HOME;
         }
 
-        // Bei der Eingabe 11 soll das Spiel gespeichert werden
-        if (row == 11) {
-            // Aktuell verbrauchte Zeit in die sudoku Struktur schreiben
+        // Bei der Eingabe MENU_CODE_SAVE soll das Spiel gespeichert werden
+        if (row == MENU_CODE_SAVE) {
+            // Aktuellen Spielstand und verbrauchte Zeit in die sudoku Struktur schreiben
+            gameToSavegame(&game, &sudoku);
             sudoku.pastTime = timeDiff;
 
             // sudoku Struktur an den Savegame-Viewcontroller �bergeben und ausf�hren
-            if (viewGameSave(sudoku)) {
+            if (viewGameSave(sudoku, &journal)) {
                 saved = 1;
+                view.valid = 0;
                 continue;
             } else {
                 // Darf nicht auftreten
@@ -405,15 +527,32 @@ int viewGamePlay(struct savegame sudoku) {
             }
         }
 
-        // Bei der Eingabe 12 soll ein Tipp gegeben werden -> zuf�llig gew�hltes Feld f�llen
-        if (row == 12) {
-            // Nur ein Feld f�llen, wenn es noch leere Felder gibt
-            if (countEmptyFields(sudoku.sudokuGrid) > 0) {
-                sudoku.sudokuGrid = fillRandomField(sudoku.sudokuGridSolved, sudoku.sudokuGrid);
+        // Bei der Eingabe MENU_CODE_HINT soll ein Tipp gegeben werden -> Feld des leichtesten logischen Schrittes füllen
+        if (row == MENU_CODE_HINT) {
+            if (findGameHint(&game, &hint)) {
+                field.row = hint.cell / SIZE;
+                field.column = hint.cell % SIZE;
+                playGameMove(&game, &journal, field, hint.value, (uint32_t) (timeDiff * 1000.0), &error);
+                logAutosave(&autosave, AUTOSAVE_MOVE, hint.cell, hint.value, (uint32_t) (timeDiff * 1000.0));
+                hinted = 1;
+            } else if (game.emptyCount > 0 || game.conflicts > 0) {
+                hinted = -1;
             }
 
             // Sudoku pr�fen
-            solved = checkSudoku(sudoku.sudokuGrid);
+            solved = isGameSolved(&game);
+            continue;
+        }
+
+        // Bei der Eingabe MENU_CODE_UNDO bzw. MENU_CODE_REDO wird ein Zug aus dem Verlauf zurückgenommen bzw. wiederholt
+        if (row == MENU_CODE_UNDO || row == MENU_CODE_REDO) {
+            if ((row == MENU_CODE_UNDO ? undoGameMove(&game, &journal) : redoGameMove(&game, &journal)) < 0) {
+                undone = 1;
+            } else {
+                logAutosave(&autosave, row == MENU_CODE_UNDO ? AUTOSAVE_UNDO : AUTOSAVE_REDO, 0, 0, (uint32_t) (timeDiff * 1000.0));
+            }
+
+            solved = isGameSolved(&game);
             continue;
         }
 
@@ -426,36 +565,46 @@ int viewGamePlay(struct savegame sudoku) {
         readLine(inputString);
         value = checkAndConvertInputToInt(inputString);
 
-        if (row < 1 || row > 12 || column < 0 || value < 0 || value > 9) {
+        // Ab 16x16 können Werte über 9 wie auf dem Spielfeld als Buchstabe eingegeben werden
+        if (SIZE > 9 && strlen(inputString) == 1 && isalpha((unsigned char) inputString[0])) {
+            value = charToValue(inputString[0]);
+        }
+
+        if (row < 1 || row > SIZE || column < 0 || value < 0 || value > SIZE) {
             errorInput = 1;
         } else {
             errorInput = 0;
             field.row = row - 1;
             field.column = column;
             // Feld im Sudoku �ndern
-            sudoku.sudokuGrid = alterValue(sudoku.sudokuGrid, field, value, &error);
+            playGameMove(&game, &journal, field, value, (uint32_t) (timeDiff * 1000.0), &error);
 
             if (error == 1 || error == 2 || error == 3) {
                 alterError = 1;
             } else {
                 alterError = 0;
+                logAutosave(&autosave, AUTOSAVE_MOVE, field.row * SIZE + field.column, value, (uint32_t) (timeDiff * 1000.0));
             }
         }
 
         // Sudoku pr�fen
-        solved = checkSudoku(sudoku.sudokuGrid);
+        solved = isGameSolved(&game);
     } while (solved == 0);
 
+    // Gelöste Spiele müssen nicht wiederhergestellt werden
+    stopAutosave(&autosave, 1);
+    freeJournal(&journal);
+
     // Aktuell verbrauchte Zeit berechnen
     timeDiff = difftime(time(NULL), (time_t) 0) - startTime + staticPastTime;
     // Verbrauchte Zeit in hh:mm:ss umrechnen und in Struktur schreiben
     pastTime = getPastTime(timeDiff);
 
     // Sudoku gel�st Ausgabe
-    system("cls");
+    clearScreen();
     printf("SKRAM Sudoku\n");
     printf("\n");
-    printGrid(sudoku.sudokuGrid);
+    drawGrid(&view, &game.board, 3);
     printf("\n");
     printf("Herzlichen Glueckwunsch!\n");
     printf("Sie haben das Sudoku erfolgreich geloest!\n");
@@ -463,7 +612,8 @@ int viewGamePlay(struct savegame sudoku) {
     printf("Benoetigte Zeit: %02d:%02d:%02d\n", pastTime.hours, pastTime.minutes, pastTime.seconds);
     printf("\n");
     printf("Bitte beliebige Taste druecken, um zum Startbildschirm zurueckzukehren...\n");
-    getch();
+    flushScreen();
+    readKey();
 
     // Nach beliebigen Tastendruck zum Startbilschirm zur�ckkehren
     return VIEW_HOME;
@@ -472,62 +622,88 @@ int viewGamePlay(struct savegame sudoku) {
 /**
  * Funktion:        viewGameSave
  *
- * Parameter:       sudoku (struct savegame) -> Savegame-Struktur, in dem der aktuelle Spielfortschritt, die L�sung und die bislang ben�tigte Zeit enthalten ist
+ * Parameter:       sudoku (struct savegame) -> Savegame-Struktur, in dem der aktuelle Spielfortschritt, die Lösung und die bislang benötigte Zeit enthalten ist
+ * Parameter:       journal (const struct journal *) -> Zugverlauf, der mit gespeichert wird
  *
- * R�ckgabewert:    Gibt eine 0 f�r falsch zur�ck und eine 1 f�r korrekt
+ * Rückgabewert:    Gibt eine 0 für falsch zurück und eine 1 für korrekt
  *
  * Beschreibung:    Zeigt den Speicherbildschirm an an.
  */
-int viewGameSave(struct savegame sudoku) {
-    int i, input, errorInput;
-    char inputString[STRLEN];
+int viewGameSave(struct savegame sudoku, const struct journal *journal) {
+    struct saveStore store;
+    int input, errorInput;
+    char inputString[STRLEN], name[SAVESTORE_NAME_LENGTH];
+    time_t now;
     errorInput = 0;
 
-    // Wiederholt die Anzeige des Speicherbildschirms so oft, bis eine g�ltige Eingabe erfolgt ist
-    do {
-        system("cls");
+    if (!openSaveStore(&store)) {
+        // Darf nicht auftreten
+        die();
+    }
+
+    // Wiederholt die Anzeige des Speicherbildschirms so oft, bis der Spielstand gespeichert oder abgebrochen wurde
+    for (;;) {
+        clearScreen();
         printf("SKRAM Sudoku\n");
         printf("\n");
         printf("Spielstand speichern\n");
 
-        // Speicherstand 1 - 10 (0 - 9)
-        for (i = 1; i <= 10; i++) {
-            if (checkSavegameSlot(i)) {
-                printf("[%d] Spielstand %d (Waehlen zum Ueberschreiben)\n", i, i);
-            } else {
-                printf("[%d] Spielstand %d (leer)\n", i, i);
-            }
-        }
+        printSavegameList(&store, " (Waehlen zum Ueberschreiben)");
 
-        printf("[11] Abbrechen\n");
+        printf("\n");
+        printf("[%d] Neuer Spielstand\n", store.count + 1);
+        printf("[%d] Abbrechen\n", store.count + 2);
         printf("\n");
 
         if (errorInput == 1) {
             printf("Die Eingabe war Fehlerhaft, bitte erneut eingeben!\n");
+        } else if (errorInput == 2) {
+            printf("Der Spielstand konnte nicht gespeichert werden. Bitte loeschen Sie alte Spielstaende.\n");
+        } else if (errorInput == 3) {
+            printf("Der Name ist zu lang (hoechstens %d Zeichen), bitte erneut eingeben!\n", SAVESTORE_NAME_LENGTH - 1);
         }
 
         printf("Eingabe: ");
         readLine(inputString);
         input = checkAndConvertInputToInt(inputString);
 
-        // Bei Eingabe 11 zum Spiel zur�ckkehren ohne Speichern
-        if (input == 11) {
+        // Bei Eingabe 'Abbrechen' zum Spiel zurückkehren ohne Speichern
+        if (input == store.count + 2) {
+            closeSaveStore(&store);
             return 1;
         }
 
-        if (input < 1 || input > 10) {
+        if (input < 1 || input > store.count + 1) {
             errorInput = 1;
+            continue;
+        }
+
+        if (input <= store.count) {
+            // Vorhandenen Spielstand überschreiben
+            strcpy(name, store.entries[input - 1].name);
         } else {
-            errorInput = 0;
+            printf("Name des Spielstands (leer = aktuelles Datum): ");
+            readLine(inputString);
+
+            if (inputString[0] == '\0') {
+                now = time(NULL);
+                strftime(name, sizeof(name), "Spiel vom %d.%m.%Y %H:%M:%S", localtime(&now));
+            } else if (snprintf(name, sizeof(name), "%s", inputString) >= (int) sizeof(name)) {
+                errorInput = 3;
+                continue;
+            }
         }
-    } while (input < 1 || input > 10);
 
-    // Spielfortschritt speichern und zum Spiel zur�ckkehren
-    if (!writeSavegame(sudoku, input)) {
-        // Darf nicht auftreten
-        die();
+        // Spielfortschritt speichern und zum Spiel zurückkehren
+        if (writeStoredSave(&store, name, &sudoku, journal)) {
+            break;
+        }
+
+        errorInput = 2;
     }
 
+    closeSaveStore(&store);
+
     return 1;
 }
 
@@ -540,15 +716,16 @@ int viewGameSave(struct savegame sudoku) {
  */
 int viewGameReadFromSudokuFile() {
     struct savegame sudoku;
-    struct sudoku parsedSudoku;
+    struct sudoku parsedSudoku, solvedSudoku;
+    struct rating rating;
 
-    int input = 0, errorInput = 0, difficulty = 0, difficultyInput = 0;
+    int input = 0, errorInput = 0, errorLine = 0, difficulty = 0, difficultyInput = 0, isPuzzle = 0;
     char inputString[STRLEN], difficultyInputString[STRLEN];
     errorInput = -1;
 
     // Wiederholt die Anzeige des Startbilschirms so oft, bis eine g�ltige Eingabe erfolgt ist
     do {
-        system("cls");
+        clearScreen();
         printf("SKRAM Sudoku\n");
         printf("\n");
         printf("Sudoku aus Datei laden\n");
@@ -557,20 +734,23 @@ int viewGameReadFromSudokuFile() {
         printf("\n");
 
 
-        showParserErrorMessage(errorInput);
+        showParserErrorMessage(errorInput, errorLine);
 
         printf("Eingabe: ");
         readLine(inputString);
         input = checkAndConvertInputToInt(inputString);
 
-        parsedSudoku = getSudokuFromFile(inputString, &errorInput);
+        parsedSudoku = getSudokuFromFile(inputString, &errorInput, &errorLine, &solvedSudoku);
+
+        // Ein Rätsel mit leeren Feldern wird so gespielt, wie es ist; nur ein volles Gitter wird ausgedünnt
+        isPuzzle = errorInput == PARSER_VALID && countEmptyFields(parsedSudoku) > 0;
 
         do {
-            if (input == 1 || errorInput != PARSER_VALID) {
+            if (input == 1 || errorInput != PARSER_VALID || isPuzzle) {
                 break;
             }
 
-            system("cls");
+            clearScreen();
             printf("SKRAM Sudoku\n");
             printf("\n");
             printf("Sudoku aus Datei laden\n");
@@ -608,18 +788,23 @@ int viewGameReadFromSudokuFile() {
             return VIEW_HOME;
         }
 
-        if (checkSudoku(parsedSudoku)) {
-            sudoku.sudokuGridSolved = parsedSudoku;
-            sudoku.sudokuGrid = makeSodukoPlayable(parsedSudoku, difficulty);
+        if (isPuzzle) {
+            rateSudoku(&parsedSudoku, &rating);
+            sudoku.sudokuGridSolved = solvedSudoku;
+            sudoku.sudokuGrid = parsedSudoku;
             sudoku.pastTime = 0.0;
-        } else if (errorInput == -1 || errorInput == 0) {
-            errorInput = PARSER_SUDOKU_INVALID;
+            sudoku.difficulty = ratingToDifficulty(&rating);
+        } else if (errorInput == PARSER_VALID) {
+            sudoku.sudokuGridSolved = solvedSudoku;
+            sudoku.sudokuGrid = makeSodukoPlayableRated(solvedSudoku, difficulty, getSessionRandom());
+            sudoku.pastTime = 0.0;
+            sudoku.difficulty = difficulty;
         }
 
     } while (input != 1 && errorInput != PARSER_VALID);
 
     // Eingelesenes Sudoku an den Play-View weitergeben und dessen R�ckgabewert zur�ckgeben
-    return viewGamePlay(sudoku);
+    return viewGamePlay(sudoku, NULL);
 }
 
 /**
@@ -636,7 +821,7 @@ int viewCredits() {
 
     // Wiederholt die Anzeige des Credits-Bildschirms so oft, bis eine g�ltige Eingabe erfolgt ist
     do {
-        system("cls");
+        clearScreen();
         printf("SKRAM Sudoku\n");
         printf("\n");
         printf("Projektteam\n");
@@ -668,58 +853,45 @@ int viewCredits() {
 }
 
 /**
- * Funktion:        printGrid
- *
- * Parameter:       sudokuGrid (struct sudoku) -> Nimmt den R�ckgabewert von Funktion 'generateFullSudoku' oder 'makeSudokuPlayable' entgegen
+ * Zeigt eine Fehlernachricht entsprechend ihrer Bedeutung an.
  *
- * Beschreibung:    Gibt das Sudokuspielfeld in der Kommandozeile aus.
+ * @param errorCode Fehlercode, zu welchem eine Nachricht darzustellen ist.
+ * @param errorLine Zeile der Datei, in welcher der Fehler gefunden wurde (0 = unbekannt)
  */
-void printGrid(struct sudoku sudokuGrid) {
-    int i, j, k, l, row;
-
-    // Windows API (Textfarbe �ndern -> Definition)
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO consoleInfo;
-    WORD savedAttributes;
-    GetConsoleScreenBufferInfo(hConsole, &consoleInfo);
-    savedAttributes = consoleInfo.wAttributes;
-
-    row = 1;
-
-    printf("     A B C   D E F   G H I\n");
-    printf("   +-------+-------+-------+\n");
-
-    for (i = 0; i < 3; i++) {
-        for (j = (9 / 3 * i); j < ((9 / 3 * i) + 3); j++) {
-            printf("%d. | ", row++);
-
-            for (k = 0; k < 3; k++) {
-                for (l = (9 / 3 * k); l < ((9 / 3 * k) + 3); l++) {
-                    // Falls das aktuelle Feld ein Standardfeld ist (generiert), dann gelb f�rben, sonst wei� f�rben
-                    if (sudokuGrid.generated[j][l] == 1) {
-                        SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY);
-                    } else {
-                        SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-                    }
-
-                    if (sudokuGrid.value[j][l] == 0) {
-                        printf("  ");
-                    } else {
-                        printf("%d ", sudokuGrid.value[j][l]);
-                    }
-
-                    // Textfarbe zur�cksetzen
-                    SetConsoleTextAttribute(hConsole, savedAttributes);
-                }
-
-                printf("\b | ");
+void showParserErrorMessage(int errorCode, int errorLine) {
+    switch (errorCode) {
+        case (PARSER_FILE_INACCESSIBLE):
+            printf("Die angegebene Datei existiert nicht, oder auf sie kann nicht zugegriffen werden.\n");
+            printf("Bitte ueberpruefen sie Ihre Eingabe und versuchen es erneut!\n\n");
+            break;
+
+        case (PARSER_SUDOKU_NUMBERS_INVALID):
+            if (errorLine > 0) {
+                printf("Die Datei enthaelt in Zeile %d ungueltige Eingaben.", errorLine);
+            } else {
+                printf("Die Datei enthaelt ungueltigen Eingaben.");
             }
 
-            printf("\n");
-        }
+            printf("Sie sollte %d Reihen enthalten,\nwelche wie folgt aufgebaut sein sollten:\n", SIZE);
+            printf("\"i,i,i,...\" (%d Werte, i steht fuer eine Ziffer von 1-%c, 0 oder . fuer ein leeres Feld)\n", SIZE,
+                   valueToChar(SIZE));
+            printf("Alternativ: eine Zeile mit %d Zeichen.\n\n", GRID_CELLS);
+            break;
 
-        printf("   +-------+-------+-------+\n");
-    }
+        case (PARSER_SUDOKU_INVALID):
+            printf("Das Sudoku ist kein gueltiges Sudoku.\n");
+            printf("Die Zahlen in einer Reihe, Zeile und in einem Block muessen einmalig sein.\n\n");
+            break;
 
+        case (PARSER_SUDOKU_UNSOLVABLE):
+            printf("Das Sudoku hat keine Loesung.\n");
+            printf("Die vorgegebenen Zahlen widersprechen sich nicht direkt, lassen sich aber nicht zu Ende fuehren.\n\n");
+            break;
+
+        case (PARSER_SUDOKU_AMBIGUOUS):
+            printf("Das Sudoku hat mehrere Loesungen.\n");
+            printf("Bitte geben Sie weitere Zahlen vor, damit die Loesung eindeutig ist.\n\n");
+            break;
+    }
     return;
 }
@@ -0,0 +1,750 @@
+/*
+ * SKRAM Sudoku - Mikrobenchmarks
+ *
+ * Misst die Laufzeit der zentralen Routinen des Kerns (Generieren, Ausdünnen, Lösen, Bewerten, Prüfen, Einlesen,
+ * Spielstände kodieren, Zeitanzeige) und gibt sie als JSON aus, damit Änderungen an der Engine mit einer
+ * gespeicherten Basismessung verglichen werden können.
+ *
+ * Aufruf: sudoku-bench [--runs N] [--warmup N] [--seed N] [--filter TEXT] [--output DATEI] [--baseline DATEI] [--threshold PROZENT]
+ *
+ * Jede Messung ruft eine Routine 'iterations' mal auf festen, aus dem Startwert erzeugten Eingaben auf. Nach --warmup
+ * verworfenen Messungen folgen --runs gewertete, aus denen Minimum, Median und 99. Perzentil der Zeit je Aufruf
+ * berechnet werden. Gleicher Startwert = gleiche Eingaben und gleiche Aufruffolgen.
+ *
+ * Mit --baseline wird der Median jeder Routine mit einer früheren Ausgabe verglichen. Liegt er um mehr als --threshold
+ * Prozent darüber, endet das Programm mit dem Rückgabewert 2.
+ */
+
+#include "header/sudokuCore.h"
+
+// Anzahl der vorab erzeugten Eingaben, die reihum verwendet werden
+#define INPUT_COUNT 64
+
+// Standardwerte der Parameter
+#define DEFAULT_RUNS 30
+#define DEFAULT_WARMUP 3
+#define DEFAULT_SEED 1
+#define DEFAULT_THRESHOLD 10.0
+
+// Name der Datei, mit der das Einlesen gemessen wird (wird danach gelöscht)
+#define BENCH_PUZZLE_FILE "sudoku-bench.tmp"
+
+// Zeile der Datei mit dem absichtlich fehlerhaften Rätsel (3. Reihe des kommagetrennten Gitters ab Zeile 2)
+#define BENCH_ERROR_LINE 4
+
+// Eingaben und Zustand aller Messungen
+struct benchContext {
+    struct sudoku full[INPUT_COUNT];
+    struct sudoku puzzle[INPUT_COUNT];
+    struct savegame save[INPUT_COUNT];
+    uint8_t grid[INPUT_COUNT][GRID_CELLS];   // Rätsel als flaches Gitter
+    uint8_t solved[INPUT_COUNT][GRID_CELLS]; // Lösungen als flaches Gitter
+    uint8_t encoded[INPUT_COUNT][SAVEGAME_SIZE];
+    struct game game;
+    int gameInput;
+    struct random random;
+};
+
+// Eine Messung: ruft die Routine 'iterations' mal auf und gibt eine Prüfsumme der Ergebnisse zurück
+typedef uint64_t (*benchFunction)(struct benchContext *context, int iterations);
+
+// Eintrag der Benchmark-Tabelle
+struct benchmark {
+    const char *name;
+    benchFunction function;
+    int iterations;
+};
+
+// Ergebnis einer Routine in Nanosekunden je Aufruf
+struct benchResult {
+    double minimum;
+    double median;
+    double p99;
+};
+
+// Verhindert, dass der Compiler Aufrufe ohne verwendetes Ergebnis entfernt
+static volatile uint64_t benchSink;
+
+/**
+ * Funktion:        sumSudoku
+ *
+ * Parameter:       sudokuGrid (const struct sudoku *) -> Sudoku
+ *
+ * Rückgabewert:    Gibt eine einfache Prüfsumme der Werte zurück
+ */
+static uint64_t sumSudoku(const struct sudoku *sudokuGrid) {
+    return (uint64_t) sudokuGrid->value[0][0] + (uint64_t) sudokuGrid->value[SIZE / 2][SIZE / 2] * 10
+           + (uint64_t) sudokuGrid->value[SIZE - 1][SIZE - 1] * 100;
+}
+
+// Messfunktionen: rufen je eine Routine 'iterations' mal auf und verwenden die Eingaben aus 'context' reihum
+
+static uint64_t benchGeneratePattern(struct benchContext *context, int iterations) {
+    struct sudoku sudokuGrid;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sudokuGrid = generateFullSudoku(&context->random, GENERATOR_PATTERN);
+        sum += sumSudoku(&sudokuGrid);
+    }
+
+    return sum;
+}
+
+static uint64_t benchGenerateBacktrack(struct benchContext *context, int iterations) {
+    struct sudoku sudokuGrid;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sudokuGrid = generateFullSudoku(&context->random, GENERATOR_BACKTRACK);
+        sum += sumSudoku(&sudokuGrid);
+    }
+
+    return sum;
+}
+
+static uint64_t benchMakePlayable(struct benchContext *context, int iterations) {
+    struct sudoku sudokuGrid;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sudokuGrid = makeSodukoPlayable(context->full[i % INPUT_COUNT], MEDIUM, &context->random);
+        sum += sumSudoku(&sudokuGrid);
+    }
+
+    return sum;
+}
+
+static uint64_t benchMakePlayableUnique(struct benchContext *context, int iterations) {
+    struct sudoku sudokuGrid;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sudokuGrid = makeSodukoPlayableUnique(context->full[i % INPUT_COUNT], DIFFICULT, &context->random);
+        sum += sumSudoku(&sudokuGrid);
+    }
+
+    return sum;
+}
+
+static uint64_t benchMakePlayableRated(struct benchContext *context, int iterations) {
+    struct sudoku sudokuGrid;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sudokuGrid = makeSodukoPlayableRated(context->full[i % INPUT_COUNT], MEDIUM, &context->random);
+        sum += sumSudoku(&sudokuGrid);
+    }
+
+    return sum;
+}
+
+static uint64_t benchSolveGrid(struct benchContext *context, int iterations) {
+    uint8_t solution[GRID_CELLS];
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sum += (uint64_t) solveGrid(context->grid[i % INPUT_COUNT], solution) + solution[GRID_CELLS / 2];
+    }
+
+    return sum;
+}
+
+static uint64_t benchCountSolutions(struct benchContext *context, int iterations) {
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sum += (uint64_t) countGridSolutions(context->grid[i % INPUT_COUNT], 2);
+    }
+
+    return sum;
+}
+
+static uint64_t benchRateSudoku(struct benchContext *context, int iterations) {
+    struct rating rating;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        rateSudoku(&context->puzzle[i % INPUT_COUNT], &rating);
+        sum += (uint64_t) rating.score;
+    }
+
+    return sum;
+}
+
+static uint64_t benchCheckSudoku(struct benchContext *context, int iterations) {
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sum += (uint64_t) checkSudoku(context->full[i % INPUT_COUNT]);
+    }
+
+    return sum;
+}
+
+static uint64_t benchCheckValue(struct benchContext *context, int iterations) {
+    struct field field;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        field.row = (i / SIZE) % SIZE;
+        field.column = i % SIZE;
+        sum += (uint64_t) checkValue(context->puzzle[i % INPUT_COUNT], field);
+    }
+
+    return sum;
+}
+
+static uint64_t benchCheckGrid(struct benchContext *context, int iterations) {
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sum += (uint64_t) checkGrid(context->solved[i % INPUT_COUNT]);
+    }
+
+    return sum;
+}
+
+static uint64_t benchCountEmptyFields(struct benchContext *context, int iterations) {
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sum += (uint64_t) countEmptyFields(context->puzzle[i % INPUT_COUNT]);
+    }
+
+    return sum;
+}
+
+static uint64_t benchFillRandomField(struct benchContext *context, int iterations) {
+    struct sudoku sudokuGrid;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sudokuGrid = fillRandomField(context->full[i % INPUT_COUNT], context->puzzle[i % INPUT_COUNT], &context->random);
+        sum += sumSudoku(&sudokuGrid);
+    }
+
+    return sum;
+}
+
+static uint64_t benchFillGameRandomField(struct benchContext *context, int iterations) {
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        // Gelöste Spiele durch das nächste Rätsel ersetzen (selten, fällt bei vielen Aufrufen kaum ins Gewicht)
+        if (context->game.emptyCount == 0) {
+            context->gameInput = (context->gameInput + 1) % INPUT_COUNT;
+            initGame(&context->game, &context->save[context->gameInput]);
+        }
+
+        fillGameRandomField(&context->game, &context->random);
+        sum += (uint64_t) context->game.emptyCount;
+    }
+
+    return sum;
+}
+
+static uint64_t benchFindGameHint(struct benchContext *context, int iterations) {
+    struct hint hint;
+    struct field field;
+    uint64_t sum = 0;
+    int i, error;
+
+    for (i = 0; i < iterations; i++) {
+        if (context->game.emptyCount == 0) {
+            context->gameInput = (context->gameInput + 1) % INPUT_COUNT;
+            initGame(&context->game, &context->save[context->gameInput]);
+        }
+
+        // Wie im Spiel: Hinweis suchen und eintragen
+        if (findGameHint(&context->game, &hint)) {
+            field.row = hint.cell / SIZE;
+            field.column = hint.cell % SIZE;
+            alterGameValue(&context->game, field, hint.value, &error);
+        }
+
+        sum += (uint64_t) hint.cell + (uint64_t) hint.technique;
+    }
+
+    return sum;
+}
+
+static uint64_t benchGetSudokuFromFile(struct benchContext *context, int iterations) {
+    struct sudoku sudokuGrid, solution;
+    char path[STRLEN] = BENCH_PUZZLE_FILE;
+    uint64_t sum = 0;
+    int i, error, errorLine;
+
+    (void) context;
+
+    for (i = 0; i < iterations; i++) {
+        sudokuGrid = getSudokuFromFile(path, &error, &errorLine, &solution);
+        sum += sumSudoku(&sudokuGrid) + sumSudoku(&solution) + (uint64_t) error;
+    }
+
+    return sum;
+}
+
+static uint64_t benchReadPuzzle(struct benchContext *context, int iterations) {
+    struct puzzleReader reader;
+    uint8_t grid[GRID_CELLS], solution[GRID_CELLS];
+    uint64_t sum = 0;
+    int i, result, hasSolution;
+
+    (void) context;
+
+    for (i = 0; i < iterations; i++) {
+        if (openPuzzleReader(&reader, BENCH_PUZZLE_FILE) != PARSER_VALID) {
+            continue;
+        }
+
+        while ((result = readPuzzle(&reader, grid, solution, &hasSolution)) != READER_END) {
+            sum += (uint64_t) (result + reader.line) + grid[0];
+        }
+
+        closePuzzleReader(&reader);
+    }
+
+    return sum;
+}
+
+static uint64_t benchEncodeSavegame(struct benchContext *context, int iterations) {
+    uint8_t buffer[SAVEGAME_SIZE];
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        encodeSavegame(&context->save[i % INPUT_COUNT], NULL, buffer);
+        sum += buffer[SAVEGAME_SIZE - 1];
+    }
+
+    return sum;
+}
+
+static uint64_t benchDecodeSavegame(struct benchContext *context, int iterations) {
+    struct savegame sudoku;
+    uint64_t sum = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        sum += (uint64_t) decodeSavegame(context->encoded[i % INPUT_COUNT], SAVEGAME_SIZE, &sudoku, NULL);
+        sum += sumSudoku(&sudoku.sudokuGrid);
+    }
+
+    return sum;
+}
+
+static uint64_t benchGetPastTime(struct benchContext *context, int iterations) {
+    struct time time;
+    uint64_t sum = 0;
+    int i;
+
+    (void) context;
+
+    for (i = 0; i < iterations; i++) {
+        time = getPastTime((double) i * 7.3);
+        sum += (uint64_t) (time.hours + time.minutes + time.seconds);
+    }
+
+    return sum;
+}
+
+// Alle Messungen; 'iterations' ist so gewählt, dass eine Messung deutlich länger als die Auflösung der Uhr dauert
+static const struct benchmark benchmarks[] = {
+    { "generateFullSudoku/pattern", benchGeneratePattern, 2000 },
+    { "generateFullSudoku/backtrack", benchGenerateBacktrack, 200 },
+    { "makeSodukoPlayable", benchMakePlayable, 2000 },
+    { "makeSodukoPlayableUnique", benchMakePlayableUnique, 20 },
+    { "makeSodukoPlayableRated", benchMakePlayableRated, 4 },
+    { "solveGrid", benchSolveGrid, 200 },
+    { "countGridSolutions", benchCountSolutions, 200 },
+    { "rateSudoku", benchRateSudoku, 50 },
+    { "checkSudoku", benchCheckSudoku, 5000 },
+    { "checkValue", benchCheckValue, 10000 },
+    { "checkGrid", benchCheckGrid, 10000 },
+    { "countEmptyFields", benchCountEmptyFields, 10000 },
+    { "fillRandomField", benchFillRandomField, 5000 },
+    { "fillGameRandomField", benchFillGameRandomField, 10000 },
+    { "findGameHint", benchFindGameHint, 2000 },
+    { "getSudokuFromFile", benchGetSudokuFromFile, 50 },
+    { "readPuzzle", benchReadPuzzle, 200 },
+    { "encodeSavegame", benchEncodeSavegame, 10000 },
+    { "decodeSavegame", benchDecodeSavegame, 10000 },
+    { "getPastTime", benchGetPastTime, 100000 }
+};
+
+#define BENCHMARK_COUNT ((int) (sizeof(benchmarks) / sizeof(benchmarks[0])))
+
+/**
+ * Funktion:        initBenchContext
+ *
+ * Parameter:       context (struct benchContext *) -> Wird mit den Eingaben gefüllt
+ * Parameter:       seed (uint64_t)                 -> Startwert
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Eingaben erzeugt wurden, andernfalls eine 0 (Datei nicht schreibbar)
+ *
+ * Beschreibung:    Erzeugt INPUT_COUNT vollständige Sudokus mit eindeutig lösbaren Rätseln (mittlerer Schwierigkeitsgrad)
+ *                  und schreibt die Datei für 'getSudokuFromFile' und 'readPuzzle': das erste Rätsel in einer Zeile, danach
+ *                  die erste Lösung als kommagetrenntes Gitter mit einem ungültigen Zeichen in Zeile BENCH_ERROR_LINE und
+ *                  zuletzt das zweite Rätsel.
+ */
+static int initBenchContext(struct benchContext *context, uint64_t seed) {
+    FILE *fileHandle;
+    int i, j;
+
+    seedRandom(&context->random, seed);
+
+    for (i = 0; i < INPUT_COUNT; i++) {
+        context->full[i] = generateFullSudoku(&context->random, DEFAULT_GENERATOR);
+        context->puzzle[i] = makeSodukoPlayableUnique(context->full[i], MEDIUM, &context->random);
+
+        context->save[i].sudokuGridSolved = context->full[i];
+        context->save[i].sudokuGrid = context->puzzle[i];
+        context->save[i].pastTime = 60.0 * i;
+        context->save[i].difficulty = MEDIUM;
+        encodeSavegame(&context->save[i], NULL, context->encoded[i]);
+
+        for (j = 0; j < GRID_CELLS; j++) {
+            context->grid[i][j] = (uint8_t) context->puzzle[i].value[j / SIZE][j % SIZE];
+            context->solved[i][j] = (uint8_t) context->full[i].value[j / SIZE][j % SIZE];
+        }
+    }
+
+    context->gameInput = 0;
+    initGame(&context->game, &context->save[0]);
+
+    fileHandle = fopen(BENCH_PUZZLE_FILE, "wb");
+
+    if (fileHandle == NULL) {
+        return 0;
+    }
+
+    for (j = 0; j < GRID_CELLS; j++) {
+        fputc(valueToChar(context->grid[0][j]), fileHandle);
+    }
+
+    fputc('\n', fileHandle);
+
+    for (j = 0; j < GRID_CELLS; j++) {
+        fputc(j == (BENCH_ERROR_LINE - 2) * SIZE + 1 ? 'X' : valueToChar(context->solved[0][j]), fileHandle);
+        fputs(j % SIZE == SIZE - 1 ? "\n" : ",", fileHandle);
+    }
+
+    for (j = 0; j < GRID_CELLS; j++) {
+        fputc(valueToChar(context->grid[1][j]), fileHandle);
+    }
+
+    fputc('\n', fileHandle);
+    fclose(fileHandle);
+
+    return 1;
+}
+
+/**
+ * Funktion:        checkPuzzleReader
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Datei aus 'initBenchContext' richtig gelesen wird, andernfalls eine 0
+ *
+ * Beschreibung:    Prüft vor den Messungen, dass ein fehlerhaftes mehrzeiliges Rätsel genau einen Fehler in seiner Zeile
+ *                  ergibt und die Zeilennummern der folgenden Rätsel stimmen.
+ */
+static int checkPuzzleReader() {
+    struct puzzleReader reader;
+    uint8_t grid[GRID_CELLS], solution[GRID_CELLS];
+    int result[3], line[3], count, hasSolution;
+
+    if (openPuzzleReader(&reader, BENCH_PUZZLE_FILE) != PARSER_VALID) {
+        return 0;
+    }
+
+    for (count = 0; count < 3; count++) {
+        result[count] = readPuzzle(&reader, grid, solution, &hasSolution);
+        line[count] = reader.line;
+    }
+
+    count = readPuzzle(&reader, grid, solution, &hasSolution);
+    closePuzzleReader(&reader);
+
+    return result[0] == READER_PUZZLE && line[0] == 1 && result[1] == READER_ERROR && line[1] == BENCH_ERROR_LINE
+           && result[2] == READER_PUZZLE && line[2] == SIZE + 2 && count == READER_END;
+}
+
+/**
+ * Funktion:        compareDouble
+ *
+ * Beschreibung:    Vergleichsfunktion für qsort (aufsteigend).
+ */
+static int compareDouble(const void *first, const void *second) {
+    double a = *(const double *) first, b = *(const double *) second;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ * Funktion:        runBenchmark
+ *
+ * Parameter:       context (struct benchContext *)      -> Eingaben
+ * Parameter:       benchmark (const struct benchmark *) -> Routine
+ * Parameter:       seed (uint64_t)                      -> Startwert des Zufallsgenerators der Routine
+ * Parameter:       warmup (int)                         -> Anzahl der verworfenen Messungen
+ * Parameter:       runs (int)                           -> Anzahl der gewerteten Messungen
+ * Parameter:       samples (double *)                   -> Platz für 'runs' Messwerte
+ *
+ * Rückgabewert:    Gibt Minimum, Median und 99. Perzentil der Zeit je Aufruf zurück
+ *
+ * Beschreibung:    Jede Routine beginnt mit demselben Zufallszustand, damit ihr Ergebnis nicht von den anderen abhängt.
+ */
+static struct benchResult runBenchmark(struct benchContext *context, const struct benchmark *benchmark, uint64_t seed,
+                                       int warmup, int runs, double *samples) {
+    struct benchResult result;
+    uint64_t start;
+    int i;
+
+    seedRandom(&context->random, seed);
+
+    for (i = 0; i < warmup; i++) {
+        benchSink += benchmark->function(context, benchmark->iterations);
+    }
+
+    for (i = 0; i < runs; i++) {
+        start = getMonotonicTime();
+        benchSink += benchmark->function(context, benchmark->iterations);
+        samples[i] = (double) (getMonotonicTime() - start) / benchmark->iterations;
+    }
+
+    qsort(samples, runs, sizeof(*samples), compareDouble);
+
+    result.minimum = samples[0];
+    result.median = runs % 2 == 1 ? samples[runs / 2] : (samples[runs / 2 - 1] + samples[runs / 2]) / 2.0;
+    result.p99 = samples[(int) ceil(0.99 * runs) - 1];
+
+    return result;
+}
+
+/**
+ * Funktion:        readBaseline
+ *
+ * Parameter:       path (const char *) -> Datei mit einer früheren Ausgabe
+ *
+ * Rückgabewert:    Gibt den Inhalt als Zeichenkette zurück (mit free freigeben), NULL wenn die Datei nicht lesbar ist
+ */
+static char *readBaseline(const char *path) {
+    FILE *fileHandle;
+    char *text;
+    long length;
+
+    fileHandle = fopen(path, "rb");
+
+    if (fileHandle == NULL) {
+        return NULL;
+    }
+
+    fseek(fileHandle, 0, SEEK_END);
+    length = ftell(fileHandle);
+    fseek(fileHandle, 0, SEEK_SET);
+    text = length >= 0 ? malloc((size_t) length + 1) : NULL;
+
+    if (text != NULL) {
+        text[fread(text, 1, (size_t) length, fileHandle)] = '\0';
+    }
+
+    fclose(fileHandle);
+
+    return text;
+}
+
+/**
+ * Funktion:        findBaselineMedian
+ *
+ * Parameter:       baseline (const char *) -> Inhalt einer früheren Ausgabe
+ * Parameter:       name (const char *)     -> Name der Routine
+ * Parameter:       median (double *)       -> Enthält nach dem Funktionsaufruf den gespeicherten Median
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Routine in der Basismessung enthalten ist, andernfalls eine 0
+ *
+ * Beschreibung:    Sucht den Eintrag im eigenen Ausgabeformat (ein Objekt je Zeile), ein allgemeiner JSON-Leser ist nicht nötig.
+ */
+static int findBaselineMedian(const char *baseline, const char *name, double *median) {
+    char key[STRLEN];
+    const char *entry, *end;
+
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    entry = strstr(baseline, key);
+
+    if (entry == NULL) {
+        return 0;
+    }
+
+    end = strchr(entry, '}');
+    entry = strstr(entry, "\"median_ns\": ");
+
+    if (entry == NULL || (end != NULL && entry > end)) {
+        return 0;
+    }
+
+    return sscanf(entry + strlen("\"median_ns\": "), "%lf", median) == 1;
+}
+
+/**
+ * Funktion:        printUsage
+ *
+ * Beschreibung:    Gibt die Aufrufparameter aus.
+ */
+static void printUsage() {
+    fprintf(stderr, "Aufruf: sudoku-bench [--runs N] [--warmup N] [--seed N] [--filter TEXT] [--output DATEI] "
+                    "[--baseline DATEI] [--threshold PROZENT]\n");
+
+    return;
+}
+
+// Hauptprogramm
+int main(int argc, char *argv[]) {
+    struct benchContext *context;
+    struct benchResult result;
+    FILE *output;
+    const char *filter, *outputPath, *baselinePath;
+    char *baseline;
+    double *samples, threshold, baselineMedian, change;
+    uint64_t seed;
+    int runs, warmup, i, first, regressions;
+
+    runs = DEFAULT_RUNS;
+    warmup = DEFAULT_WARMUP;
+    seed = DEFAULT_SEED;
+    threshold = DEFAULT_THRESHOLD;
+    filter = NULL;
+    outputPath = NULL;
+    baselinePath = NULL;
+
+    // Parameter auswerten
+    for (i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--runs") == 0) {
+            runs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--warmup") == 0) {
+            warmup = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--filter") == 0) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0) {
+            outputPath = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0) {
+            baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0) {
+            threshold = atof(argv[++i]);
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (runs < 1 || warmup < 0 || threshold < 0) {
+        printUsage();
+        return 1;
+    }
+
+    baseline = NULL;
+
+    if (baselinePath != NULL && (baseline = readBaseline(baselinePath)) == NULL) {
+        fprintf(stderr, "Die Datei %s kann nicht gelesen werden.\n", baselinePath);
+        return 1;
+    }
+
+    context = malloc(sizeof(*context));
+    samples = malloc(sizeof(*samples) * runs);
+
+    if (context == NULL || samples == NULL) {
+        fprintf(stderr, "Nicht genug Speicher.\n");
+        return 1;
+    }
+
+    init(seed);
+
+    if (!initBenchContext(context, seed)) {
+        fprintf(stderr, "Die Datei %s kann nicht geschrieben werden.\n", BENCH_PUZZLE_FILE);
+        return 1;
+    }
+
+    if (!checkPuzzleReader()) {
+        fprintf(stderr, "Die Datei %s wird falsch eingelesen.\n", BENCH_PUZZLE_FILE);
+        remove(BENCH_PUZZLE_FILE);
+        return 1;
+    }
+
+    output = outputPath == NULL ? stdout : fopen(outputPath, "wb");
+
+    if (output == NULL) {
+        fprintf(stderr, "Die Datei %s kann nicht geschrieben werden.\n", outputPath);
+        remove(BENCH_PUZZLE_FILE);
+        return 1;
+    }
+
+    fprintf(output, "{\n  \"seed\": %llu,\n  \"runs\": %d,\n  \"warmup\": %d,\n  \"benchmarks\": [\n",
+            (unsigned long long) seed, runs, warmup);
+    fprintf(stderr, "%-30s %12s %12s %12s\n", "Routine", "min ns", "median ns", "p99 ns");
+
+    first = 1;
+    regressions = 0;
+
+    for (i = 0; i < BENCHMARK_COUNT; i++) {
+        if (filter != NULL && strstr(benchmarks[i].name, filter) == NULL) {
+            continue;
+        }
+
+        result = runBenchmark(context, &benchmarks[i], seed + (uint64_t) i, warmup, runs, samples);
+
+        fprintf(output, "%s    {\"name\": \"%s\", \"iterations\": %d, \"min_ns\": %.2f, \"median_ns\": %.2f, \"p99_ns\": %.2f}",
+                first ? "" : ",\n", benchmarks[i].name, benchmarks[i].iterations, result.minimum, result.median, result.p99);
+        fprintf(stderr, "%-30s %12.1f %12.1f %12.1f", benchmarks[i].name, result.minimum, result.median, result.p99);
+        first = 0;
+
+        // Vergleich mit der Basismessung über den Median (unempfindlich gegen einzelne Ausreißer)
+        if (baseline != NULL && findBaselineMedian(baseline, benchmarks[i].name, &baselineMedian) && baselineMedian > 0) {
+            change = (result.median / baselineMedian - 1.0) * 100.0;
+            fprintf(stderr, "  %+7.1f %%", change);
+
+            if (change > threshold) {
+                fprintf(stderr, "  LANGSAMER");
+                regressions++;
+            }
+        }
+
+        fprintf(stderr, "\n");
+    }
+
+    fprintf(output, "\n  ]\n}\n");
+
+    if (baseline != NULL) {
+        fprintf(stderr, "%d Routine(n) mehr als %.1f %% langsamer als %s.\n", regressions, threshold, baselinePath);
+    }
+
+    if (output != stdout) {
+        fclose(output);
+    }
+
+    remove(BENCH_PUZZLE_FILE);
+    free(baseline);
+    free(samples);
+    free(context);
+
+    return regressions > 0 ? 2 : 0;
+}
@@ -0,0 +1,229 @@
+/*
+ * SKRAM Sudoku - Generator
+ *
+ * Erzeugt ohne Benutzeroberfläche beliebig viele eindeutig lösbare Sudokus und gibt sie zeilenweise aus:
+ *
+ *     <Rätsel mit GRID_CELLS Zeichen, '.' = leer> <Lösung mit GRID_CELLS Zeichen>
+ *
+ * Aufruf: sudoku-gen --count 1000000 --difficulty 3 --threads 8 [--output datei.txt] [--seed 42] [--generator 1|2]
+ *
+ * --generator 1 = Grundmuster mit Symmetrietransformation, 2 = zufällige Tiefensuche (Standard)
+ *
+ * Der Schwierigkeitsgrad richtet sich nach den benötigten Lösungstechniken (siehe rating.h), nicht nach der Anzahl leerer Felder.
+ *
+ * Jeder Thread hat seinen eigenen Zufallsgenerator und Ausgabepuffer. Gesperrt wird nur beim Schreiben eines vollen Puffers.
+ */
+
+#include <pthread.h>
+
+#include "header/sudokuCore.h"
+
+// Größe des Ausgabepuffers je Thread
+#define OUTPUT_BUFFER_SIZE 65536
+
+// Länge einer Ausgabezeile (Rätsel, Leerzeichen, Lösung, Zeilenumbruch)
+#define LINE_LENGTH (2 * GRID_CELLS + 2)
+
+// Gemeinsame Ausgabe aller Threads
+struct output {
+    FILE *fileHandle;
+    pthread_mutex_t lock;
+};
+
+// Auftrag eines Threads
+struct generatorJob {
+    struct output *output;
+    long long count;
+    int difficulty;
+    int generator;
+    uint64_t seed;
+};
+
+/**
+ * Funktion:        flushOutput
+ *
+ * Parameter:       output (struct output *) -> Gemeinsame Ausgabe
+ * Parameter:       buffer (const char *)    -> Puffer des Threads
+ * Parameter:       length (size_t)          -> Anzahl der Zeichen im Puffer
+ *
+ * Beschreibung:    Schreibt einen vollen Puffer am Stück in die Ausgabe.
+ */
+static void flushOutput(struct output *output, const char *buffer, size_t length) {
+    pthread_mutex_lock(&output->lock);
+    fwrite(buffer, 1, length, output->fileHandle);
+    pthread_mutex_unlock(&output->lock);
+
+    return;
+}
+
+/**
+ * Funktion:        formatPuzzle
+ *
+ * Parameter:       puzzle (const struct sudoku *)   -> Spielbares Sudoku
+ * Parameter:       solution (const struct sudoku *) -> Lösung
+ * Parameter:       line (char *)                    -> Zielpuffer mit mindestens LINE_LENGTH Zeichen
+ *
+ * Beschreibung:    Formatiert Rätsel und Lösung als eine Ausgabezeile.
+ */
+static void formatPuzzle(const struct sudoku *puzzle, const struct sudoku *solution, char *line) {
+    int i;
+
+    for (i = 0; i < GRID_CELLS; i++) {
+        line[i] = valueToChar(puzzle->value[i / SIZE][i % SIZE]);
+        line[GRID_CELLS + 1 + i] = valueToChar(solution->value[i / SIZE][i % SIZE]);
+    }
+
+    line[GRID_CELLS] = ' ';
+    line[LINE_LENGTH - 1] = '\n';
+
+    return;
+}
+
+/**
+ * Funktion:        runGenerator
+ *
+ * Parameter:       argument (void *) -> Auftrag des Threads (struct generatorJob)
+ *
+ * Rückgabewert:    Gibt NULL zurück
+ *
+ * Beschreibung:    Erzeugt die Sudokus eines Threads.
+ */
+static void *runGenerator(void *argument) {
+    struct generatorJob *job = argument;
+    struct sudoku solution, puzzle;
+    struct random random;
+    char buffer[OUTPUT_BUFFER_SIZE];
+    size_t length;
+    long long i;
+
+    seedRandom(&random, job->seed);
+    length = 0;
+
+    for (i = 0; i < job->count; i++) {
+        solution = generateFullSudoku(&random, job->generator);
+        puzzle = makeSodukoPlayableRated(solution, job->difficulty, &random);
+
+        if (length + LINE_LENGTH > OUTPUT_BUFFER_SIZE) {
+            flushOutput(job->output, buffer, length);
+            length = 0;
+        }
+
+        formatPuzzle(&puzzle, &solution, buffer + length);
+        length += LINE_LENGTH;
+    }
+
+    if (length > 0) {
+        flushOutput(job->output, buffer, length);
+    }
+
+    return NULL;
+}
+
+/**
+ * Funktion:        printUsage
+ *
+ * Beschreibung:    Gibt die Aufrufparameter aus.
+ */
+static void printUsage() {
+    fprintf(stderr, "Aufruf: sudoku-gen --count N [--difficulty 1|2|3] [--threads N] [--output DATEI] [--seed N] [--generator 1|2]\n");
+
+    return;
+}
+
+// Hauptprogramm
+int main(int argc, char *argv[]) {
+    struct output output;
+    struct generatorJob *jobs;
+    struct random seeds;
+    pthread_t *threads;
+    long long count;
+    int difficulty, generator, threadCount, i;
+    uint64_t seed;
+    const char *outputPath;
+
+    count = -1;
+    difficulty = MEDIUM;
+    generator = DEFAULT_GENERATOR;
+    threadCount = getProcessorCount();
+    seed = (uint64_t) time(NULL);
+    outputPath = NULL;
+
+    // Parameter auswerten
+    for (i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--count") == 0) {
+            count = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--difficulty") == 0) {
+            difficulty = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            threadCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--output") == 0) {
+            outputPath = argv[++i];
+        } else if (strcmp(argv[i], "--generator") == 0) {
+            generator = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0) {
+            seed = (uint64_t) strtoull(argv[++i], NULL, 10);
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (count < 0 || difficulty < EASY || difficulty > DIFFICULT || threadCount < 1
+        || (generator != GENERATOR_PATTERN && generator != GENERATOR_BACKTRACK)) {
+        printUsage();
+        return 1;
+    }
+
+    output.fileHandle = outputPath == NULL ? stdout : fopen(outputPath, "wb");
+
+    if (output.fileHandle == NULL) {
+        fprintf(stderr, "Die Datei %s kann nicht geschrieben werden.\n", outputPath);
+        return 1;
+    }
+
+    pthread_mutex_init(&output.lock, NULL);
+    jobs = malloc(sizeof(*jobs) * threadCount);
+    threads = malloc(sizeof(*threads) * threadCount);
+
+    if (jobs == NULL || threads == NULL) {
+        fprintf(stderr, "Nicht genug Speicher.\n");
+        return 1;
+    }
+
+    // Sudokus gleichmäßig auf die Threads verteilen, jeder Thread erhält einen eigenen, aus --seed abgeleiteten Startwert
+    seedRandom(&seeds, seed);
+
+    for (i = 0; i < threadCount; i++) {
+        jobs[i].output = &output;
+        jobs[i].count = count / threadCount + (i < count % threadCount ? 1 : 0);
+        jobs[i].difficulty = difficulty;
+        jobs[i].generator = generator;
+        jobs[i].seed = getRandom64(&seeds);
+
+        if (pthread_create(&threads[i], NULL, runGenerator, &jobs[i]) != 0) {
+            fprintf(stderr, "Thread %d konnte nicht gestartet werden.\n", i);
+            return 1;
+        }
+    }
+
+    for (i = 0; i < threadCount; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&output.lock);
+    free(jobs);
+    free(threads);
+
+    if (output.fileHandle != stdout) {
+        fclose(output.fileHandle);
+    } else {
+        fflush(stdout);
+    }
+
+    return 0;
+}
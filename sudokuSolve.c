@@ -0,0 +1,378 @@
+/*
+ * SKRAM Sudoku - Massenlöser
+ *
+ * Löst oder prüft beliebig viele Sudokus aus einer Datei. Jede Zeile enthält ein Rätsel mit GRID_CELLS Zeichen ('.' oder '0' = leer),
+ * optional gefolgt von einem Leerzeichen und der erwarteten Lösung (Ausgabeformat von sudoku-gen). Leere Zeilen und Zeilen,
+ * die mit '#' beginnen, werden übersprungen.
+ *
+ * Aufruf: sudoku-solve --input datei.txt [--output loesungen.txt] [--threads N] [--chunk N] [--verify] [--report DATEI]
+ *
+ * Ausgabe je Rätsel in der Reihenfolge der Eingabe: die Lösung mit GRID_CELLS Ziffern oder '-', wenn es keine Lösung gibt.
+ * Mit --verify folgt ein Status: ok, mehrdeutig, unloesbar oder abweichend (Lösung stimmt nicht mit der erwarteten überein).
+ *
+ * Die Eingabe wird in den Speicher eingeblendet und in Fenstern von WINDOW_SIZE Rätseln gelesen. Das kommagetrennte Format
+ * der Einzeldateien wird ebenfalls erkannt. Jedes Fenster wird in Blöcke geteilt, die ein Thread-Pool mit
+ * Work-Stealing abarbeitet, damit einzelne sehr schwere Rätsel keinen Thread aufhalten. Am Ende werden Durchsatz und
+ * Perzentile der Laufzeit je Rätsel auf stderr ausgegeben. Mit --report werden danach die Messwerte der Instrumentierung
+ * in die Datei ('-' = stderr) geschrieben (nur mit -DSUDOKU_INSTRUMENT übersetzt).
+ */
+
+#include "header/sudokuCore.h"
+
+// Anzahl der Rätsel, die gleichzeitig im Speicher gehalten werden
+#define WINDOW_SIZE 262144
+
+// Standardgröße eines Blocks (Rätsel je Aufgabe des Thread-Pools)
+#define DEFAULT_CHUNK_SIZE 256
+
+// Ergebnis eines Rätsels
+#define RESULT_OK 0
+#define RESULT_AMBIGUOUS 1
+#define RESULT_UNSOLVABLE 2
+#define RESULT_MISMATCH 3
+
+// Ein Fenster der Eingabe mit den zugehörigen Ergebnissen
+struct solveWindow {
+    uint8_t *grids;
+    uint8_t *expected;
+    uint8_t *hasExpected;
+    uint8_t *solutions;
+    uint8_t *results;
+    long long count;
+    int chunkSize;
+    int verify;
+    struct histogram *histograms;
+};
+
+/**
+ * Funktion:        readWindow
+ *
+ * Parameter:       reader (struct puzzleReader *)  -> Eingabedatei
+ * Parameter:       window (struct solveWindow *)   -> Fenster, das gefüllt wird
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn alle Rätsel gültig waren, andernfalls eine 0
+ *
+ * Beschreibung:    Liest bis zu WINDOW_SIZE Rätsel aus der Eingabe.
+ */
+static int readWindow(struct puzzleReader *reader, struct solveWindow *window) {
+    int result, hasSolution;
+
+    window->count = 0;
+
+    while (window->count < WINDOW_SIZE) {
+        result = readPuzzle(reader, window->grids + window->count * GRID_CELLS,
+                            window->expected + window->count * GRID_CELLS, &hasSolution);
+
+        if (result == READER_END) {
+            break;
+        }
+
+        if (result == READER_ERROR) {
+            fprintf(stderr, "Zeile %d: Ungueltiges Raetsel.\n", reader->line);
+            return 0;
+        }
+
+        window->hasExpected[window->count++] = (uint8_t) hasSolution;
+    }
+
+    return 1;
+}
+
+/**
+ * Funktion:        solveChunk
+ *
+ * Parameter:       task (long long)  -> Index des Blocks im Fenster
+ * Parameter:       worker (int)      -> Index des Threads
+ * Parameter:       context (void *)  -> Fenster (struct solveWindow)
+ *
+ * Beschreibung:    Löst alle Rätsel eines Blocks und trägt ihre Laufzeit in das Histogramm des Threads ein.
+ */
+static void solveChunk(long long task, int worker, void *context) {
+    struct solveWindow *window = context;
+    long long i, first, last;
+    int solutions;
+    const uint8_t *grid;
+    uint8_t *solution, result;
+    uint64_t start;
+
+    first = task * window->chunkSize;
+    last = first + window->chunkSize < window->count ? first + window->chunkSize : window->count;
+
+    for (i = first; i < last; i++) {
+        grid = window->grids + i * GRID_CELLS;
+        solution = window->solutions + i * GRID_CELLS;
+        start = getMonotonicTime();
+
+        // Mit --verify wird in derselben Suche auch die Eindeutigkeit geprüft
+        solutions = window->verify ? solveGridUnique(grid, solution) : solveGrid(grid, solution);
+
+        if (solutions == 0) {
+            result = RESULT_UNSOLVABLE;
+        } else if (!window->verify) {
+            result = RESULT_OK;
+        } else if (solutions > 1) {
+            result = RESULT_AMBIGUOUS;
+        } else if (window->hasExpected[i] && memcmp(solution, window->expected + i * GRID_CELLS, GRID_CELLS) != 0) {
+            result = RESULT_MISMATCH;
+        } else {
+            result = RESULT_OK;
+        }
+
+        addToHistogram(&window->histograms[worker], getMonotonicTime() - start);
+        window->results[i] = result;
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        writeWindow
+ *
+ * Parameter:       fileHandle (FILE *)                 -> Ausgabedatei
+ * Parameter:       window (const struct solveWindow *) -> Gelöstes Fenster
+ * Parameter:       counts (long long[4])               -> Zähler je Ergebnis, werden erhöht
+ *
+ * Beschreibung:    Schreibt die Ergebnisse eines Fensters in der Reihenfolge der Eingabe.
+ */
+static void writeWindow(FILE *fileHandle, const struct solveWindow *window, long long counts[4]) {
+    static const char *statusText[4] = { " ok\n", " mehrdeutig\n", " unloesbar\n", " abweichend\n" };
+    char line[GRID_CELLS + 16];
+    long long i;
+    size_t length;
+    int j;
+
+    for (i = 0; i < window->count; i++) {
+        counts[window->results[i]]++;
+
+        if (window->results[i] == RESULT_UNSOLVABLE) {
+            line[0] = '-';
+            length = 1;
+        } else {
+            for (j = 0; j < GRID_CELLS; j++) {
+                line[j] = valueToChar(window->solutions[i * GRID_CELLS + j]);
+            }
+
+            length = GRID_CELLS;
+        }
+
+        if (window->verify) {
+            strcpy(line + length, statusText[window->results[i]]);
+            length += strlen(statusText[window->results[i]]);
+        } else {
+            line[length++] = '\n';
+        }
+
+        fwrite(line, 1, length, fileHandle);
+    }
+
+    return;
+}
+
+/**
+ * Funktion:        printStatistics
+ *
+ * Parameter:       histogram (const struct histogram *) -> Laufzeiten aller Rätsel
+ * Parameter:       counts (const long long[4])          -> Zähler je Ergebnis
+ * Parameter:       nanoseconds (uint64_t)               -> Gesamtlaufzeit
+ * Parameter:       verify (int)                         -> 1 = Prüfmodus
+ *
+ * Beschreibung:    Gibt Durchsatz und Perzentile der Laufzeit je Rätsel auf stderr aus.
+ */
+static void printStatistics(const struct histogram *histogram, const long long counts[4], uint64_t nanoseconds, int verify) {
+    static const double percentiles[5] = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+    double seconds;
+    int i;
+
+    seconds = (double) nanoseconds / 1e9;
+
+    fprintf(stderr, "Raetsel:      %llu in %.3f s (%.0f Raetsel/s)\n", (unsigned long long) histogram->total, seconds,
+            seconds > 0 ? (double) histogram->total / seconds : 0.0);
+
+    if (verify) {
+        fprintf(stderr, "Ergebnis:     %lld ok, %lld mehrdeutig, %lld unloesbar, %lld abweichend\n",
+                counts[RESULT_OK], counts[RESULT_AMBIGUOUS], counts[RESULT_UNSOLVABLE], counts[RESULT_MISMATCH]);
+    } else {
+        fprintf(stderr, "Ergebnis:     %lld geloest, %lld unloesbar\n", counts[RESULT_OK], counts[RESULT_UNSOLVABLE]);
+    }
+
+    fprintf(stderr, "Laufzeit:    ");
+
+    for (i = 0; i < 5; i++) {
+        fprintf(stderr, " p%g %.1f us,", percentiles[i], (double) getHistogramPercentile(histogram, percentiles[i]) / 1e3);
+    }
+
+    fprintf(stderr, " max %.1f us\n", (double) histogram->maximum / 1e3);
+
+    return;
+}
+
+/**
+ * Funktion:        writeReport
+ *
+ * Parameter:       path (const char *) -> Datei ('-' = stderr)
+ *
+ * Rückgabewert:    Gibt eine 1 zurück, wenn die Messwerte geschrieben wurden, andernfalls eine 0
+ *
+ * Beschreibung:    Gibt die Messwerte der Instrumentierung auf Anfrage aus (unabhängig von der Ausgabe bei Programmende).
+ */
+static int writeReport(const char *path) {
+#ifdef SUDOKU_INSTRUMENT
+    FILE *fileHandle;
+
+    fileHandle = strcmp(path, "-") == 0 ? stderr : fopen(path, "w");
+
+    if (fileHandle == NULL) {
+        fprintf(stderr, "Die Datei %s kann nicht geschrieben werden.\n", path);
+        return 0;
+    }
+
+    INSTRUMENT_REPORT(fileHandle);
+
+    if (fileHandle != stderr) {
+        fclose(fileHandle);
+    }
+
+    return 1;
+#else
+    fprintf(stderr, "Keine Messwerte fuer %s: ohne -DSUDOKU_INSTRUMENT uebersetzt.\n", path);
+
+    return 0;
+#endif
+}
+
+/**
+ * Funktion:        printUsage
+ *
+ * Beschreibung:    Gibt die Aufrufparameter aus.
+ */
+static void printUsage() {
+    fprintf(stderr, "Aufruf: sudoku-solve --input DATEI [--output DATEI] [--threads N] [--chunk N] [--verify] [--report DATEI]\n");
+
+    return;
+}
+
+// Hauptprogramm
+int main(int argc, char *argv[]) {
+    struct solveWindow window;
+    struct histogram total;
+    struct puzzleReader reader;
+    FILE *output;
+    const char *inputPath, *outputPath, *reportPath;
+    long long counts[4] = { 0, 0, 0, 0 };
+    int threadCount, i, valid;
+    uint64_t start;
+
+    inputPath = NULL;
+    outputPath = NULL;
+    reportPath = NULL;
+    threadCount = getProcessorCount();
+    window.chunkSize = DEFAULT_CHUNK_SIZE;
+    window.verify = 0;
+
+    // Parameter auswerten
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--verify") == 0) {
+            window.verify = 1;
+            continue;
+        }
+
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--input") == 0) {
+            inputPath = argv[++i];
+        } else if (strcmp(argv[i], "--output") == 0) {
+            outputPath = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            threadCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--chunk") == 0) {
+            window.chunkSize = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--report") == 0) {
+            reportPath = argv[++i];
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (inputPath == NULL || threadCount < 1 || window.chunkSize < 1) {
+        printUsage();
+        return 1;
+    }
+
+    if (openPuzzleReader(&reader, inputPath) != PARSER_VALID) {
+        fprintf(stderr, "Die Datei %s kann nicht gelesen werden.\n", inputPath);
+        return 1;
+    }
+
+    output = outputPath == NULL ? stdout : fopen(outputPath, "wb");
+
+    if (output == NULL) {
+        fprintf(stderr, "Die Datei %s kann nicht geschrieben werden.\n", outputPath);
+        return 1;
+    }
+
+    window.grids = malloc((size_t) WINDOW_SIZE * GRID_CELLS);
+    window.expected = malloc((size_t) WINDOW_SIZE * GRID_CELLS);
+    window.hasExpected = malloc(WINDOW_SIZE);
+    window.solutions = malloc((size_t) WINDOW_SIZE * GRID_CELLS);
+    window.results = malloc(WINDOW_SIZE);
+    window.histograms = malloc(sizeof(*window.histograms) * threadCount);
+
+    if (window.grids == NULL || window.expected == NULL || window.hasExpected == NULL || window.solutions == NULL
+        || window.results == NULL || window.histograms == NULL) {
+        fprintf(stderr, "Nicht genug Speicher.\n");
+        return 1;
+    }
+
+    for (i = 0; i < threadCount; i++) {
+        initHistogram(&window.histograms[i]);
+    }
+
+    start = getMonotonicTime();
+
+    // Fensterweise lesen, parallel lösen und in der Reihenfolge der Eingabe schreiben
+    do {
+        valid = readWindow(&reader, &window);
+
+        if (window.count > 0) {
+            if (runTasks((window.count + window.chunkSize - 1) / window.chunkSize, threadCount, solveChunk, &window) != 0) {
+                fprintf(stderr, "Nicht genug Speicher.\n");
+                return 1;
+            }
+
+            writeWindow(output, &window, counts);
+        }
+    } while (valid && window.count == WINDOW_SIZE);
+
+    initHistogram(&total);
+
+    for (i = 0; i < threadCount; i++) {
+        mergeHistogram(&total, &window.histograms[i]);
+    }
+
+    printStatistics(&total, counts, getMonotonicTime() - start, window.verify);
+
+    if (reportPath != NULL && !writeReport(reportPath)) {
+        valid = 0;
+    }
+
+    closePuzzleReader(&reader);
+
+    if (output != stdout) {
+        fclose(output);
+    } else {
+        fflush(stdout);
+    }
+
+    free(window.grids);
+    free(window.expected);
+    free(window.hasExpected);
+    free(window.solutions);
+    free(window.results);
+    free(window.histograms);
+
+    return valid ? 0 : 1;
+}